@@ -0,0 +1,98 @@
+// Use strict
+"use strict";
+
+
+// Requires
+
+// Crypto
+const crypto = require("crypto");
+
+// OS
+const os = require("os");
+
+// Secp256k1-zkp
+const secp256k1Zkp = require("../index.js");
+
+
+// Constants
+
+// Number of iterations
+const NUMBER_OF_ITERATIONS = parseInt(process.argv[2] || "1000000", 10);
+
+
+// Supporting function implementation
+
+// Measure
+const measure = function(name, run) {
+
+	// Warm up
+	for(let i = 0; i < Math.min(NUMBER_OF_ITERATIONS, 10000); ++i) {
+	
+		// Run
+		run();
+	}
+	
+	// Go through all iterations
+	const start = process.hrtime.bigint();
+	for(let i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Run
+		run();
+	}
+	const elapsed = Number(process.hrtime.bigint() - start) / 1000;
+	
+	// Return result
+	return {
+	
+		// Function
+		"Function": name,
+		
+		// Nanoseconds per call
+		"ns/call": (elapsed * 1000 / NUMBER_OF_ITERATIONS).toFixed(0),
+		
+		// Calls per second
+		"calls/s": Math.round(NUMBER_OF_ITERATIONS / elapsed * 1000000)
+	};
+};
+
+
+// Main function
+
+// Create inputs
+const secretKey = new Uint8Array(crypto.randomBytes(32));
+const publicKey = secp256k1Zkp["publicKeyFromSecretKey"](secretKey);
+const commit = secp256k1Zkp["pedersenCommit"](secretKey, "1");
+const signature = secp256k1Zkp["createSingleSignerSignature"](new Uint8Array(32), secretKey, null, publicKey, null, null);
+
+// Go through all single-item exports whose cost is mostly argument parsing and result handling
+const results = [
+	measure("isValidSecretKey", function() {
+	
+		// Return checking the secret key
+		return secp256k1Zkp["isValidSecretKey"](secretKey);
+	}),
+	measure("isValidPublicKey", function() {
+	
+		// Return checking the public key
+		return secp256k1Zkp["isValidPublicKey"](publicKey);
+	}),
+	measure("isValidCommit", function() {
+	
+		// Return checking the commit
+		return secp256k1Zkp["isValidCommit"](commit);
+	}),
+	measure("isValidSingleSignerSignature", function() {
+	
+		// Return checking the signature
+		return secp256k1Zkp["isValidSingleSignerSignature"](signature);
+	}),
+	measure("compactSingleSignerSignature", function() {
+	
+		// Return compacting the signature
+		return secp256k1Zkp["compactSingleSignerSignature"](signature);
+	})
+];
+
+// Display results
+console.log(NUMBER_OF_ITERATIONS.toString() + " iterations, " + process.arch + ", " + os.cpus()[0]["model"]);
+console.table(results);
@@ -0,0 +1,146 @@
+// Use strict
+"use strict";
+
+
+// Requires
+
+// Crypto
+const crypto = require("crypto");
+
+// OS
+const os = require("os");
+
+// Secp256k1-zkp
+const secp256k1Zkp = require("../index.js");
+
+
+// Constants
+
+// Number of proofs
+const NUMBER_OF_PROOFS = parseInt(process.argv[2] || "2048", 10);
+
+// Fraction of proofs that belong to the scanning wallet
+const OWN_PROOFS_FRACTION = 0.01;
+
+// Value
+const VALUE = "1000";
+
+
+// Supporting function implementation
+
+// Random bytes
+const randomBytes = function(size) {
+
+	// Return random bytes
+	return new Uint8Array(crypto.randomBytes(size));
+};
+
+// Create proofs
+const createProofs = function(nonce) {
+
+	// Go through all proofs
+	const proofs = [];
+	const commits = new Uint8Array(33 * NUMBER_OF_PROOFS);
+	for(let i = 0; i < NUMBER_OF_PROOFS; ++i) {
+	
+		// Create proof with the scanning wallet's nonce for some proofs and a random nonce for the others
+		const blind = randomBytes(32);
+		proofs.push(secp256k1Zkp["createBulletproof"](blind, VALUE, (i % Math.round(1 / OWN_PROOFS_FRACTION) === 0) ? nonce : randomBytes(32), randomBytes(32), new Uint8Array([]), new Uint8Array(20)));
+		commits.set(secp256k1Zkp["pedersenCommit"](blind, VALUE), i * 33);
+	}
+	
+	// Return proofs and commits
+	return [proofs, commits];
+};
+
+// Measure
+const measure = async function(name, run) {
+
+	// Run once and time it
+	const start = process.hrtime.bigint();
+	const matches = await run();
+	const elapsed = Number(process.hrtime.bigint() - start) / 1000;
+	
+	// Return result
+	return {
+	
+		// Method
+		"Method": name,
+		
+		// Microseconds per proof
+		"µs/proof": (elapsed / NUMBER_OF_PROOFS).toFixed(2),
+		
+		// Matches
+		"Matches": matches
+	};
+};
+
+
+// Main function
+
+// Run benchmark
+(async function() {
+
+	// Create proofs
+	const nonce = randomBytes(32);
+	const [proofs, commits] = createProofs(nonce);
+	const rewindContext = secp256k1Zkp["createRewindContext"](nonce);
+	
+	// Go through all methods
+	const results = [];
+	results.push(await measure("canRewindBulletproof (nonce derived per proof)", function() {
+	
+		// Go through all proofs
+		let matches = 0;
+		for(let i = 0; i < NUMBER_OF_PROOFS; ++i) {
+		
+			// Check if proof can be rewound
+			if(secp256k1Zkp["canRewindBulletproof"](proofs[i], commits.subarray(i * 33, (i + 1) * 33), nonce) === true) {
+			
+				// Increment matches
+				++matches;
+			}
+		}
+		
+		// Return matches
+		return matches;
+	}));
+	results.push(await measure("RewindContext.canRewind (cached nonce, one hash at a time)", function() {
+	
+		// Go through all proofs
+		let matches = 0;
+		for(let i = 0; i < NUMBER_OF_PROOFS; ++i) {
+		
+			// Check if proof can be rewound
+			if(rewindContext.canRewind(proofs[i], commits.subarray(i * 33, (i + 1) * 33)) === true) {
+			
+				// Increment matches
+				++matches;
+			}
+		}
+		
+		// Return matches
+		return matches;
+	}));
+	results.push(await measure("RewindContext.scan (cached nonce, multi-buffer hashing)", async function() {
+	
+		// Scan all proofs and count the streamed results
+		let matches = 0;
+		await rewindContext.scan(proofs, commits, function(processed, result) {
+		
+			// Check if result exists
+			if(result !== null) {
+			
+				// Increment matches
+				++matches;
+			}
+		});
+		
+		// Return matches
+		return matches;
+	}));
+	
+	// Display results
+	console.log(NUMBER_OF_PROOFS.toString() + " proofs, " + process.arch + ", " + os.cpus()[0]["model"]);
+	console.table(results);
+})();
@@ -0,0 +1,115 @@
+// Use strict
+"use strict";
+
+
+// Requires
+
+// Crypto
+const crypto = require("crypto");
+
+// OS
+const os = require("os");
+
+// Secp256k1-zkp
+const secp256k1Zkp = require("../index.js");
+
+
+// Constants
+
+// Number of interactive tasks
+const NUMBER_OF_INTERACTIVE_TASKS = parseInt(process.argv[2] || "200", 10);
+
+// Number of proofs each bulk scan goes through
+const NUMBER_OF_BULK_PROOFS = 200000;
+
+// Number of bulk scans running at the same time
+const NUMBER_OF_BULK_SCANS = os.cpus().length;
+
+
+// Supporting function implementation
+
+// Random bytes
+const randomBytes = function(size) {
+
+	// Return random bytes
+	return new Uint8Array(crypto.randomBytes(size));
+};
+
+// Measure interactive latency
+const measureInteractiveLatency = async function(name) {
+
+	// Go through all interactive tasks
+	const secretKey = randomBytes(32);
+	const publicKey = secp256k1Zkp["publicKeyFromSecretKey"](randomBytes(32));
+	const latencies = [];
+	for(let i = 0; i < NUMBER_OF_INTERACTIVE_TASKS; ++i) {
+	
+		// Run interactive task and record its latency
+		const start = process.hrtime.bigint();
+		await secp256k1Zkp["sharedSecretKeysFromSecretKeysAndPublicKeys"](secretKey, publicKey);
+		latencies.push(Number(process.hrtime.bigint() - start) / 1000);
+	}
+	
+	// Sort latencies
+	latencies.sort(function(first, second) {
+	
+		// Return comparing latencies
+		return first - second;
+	});
+	
+	// Return result
+	return {
+	
+		// Load
+		"Load": name,
+		
+		// Median latency
+		"p50 µs": latencies[Math.floor(latencies.length * 0.5)].toFixed(0),
+		
+		// 99th percentile latency
+		"p99 µs": latencies[Math.floor(latencies.length * 0.99)].toFixed(0)
+	};
+};
+
+
+// Main function
+
+// Run benchmark
+(async function() {
+
+	// Create bulk work which scans a proof that doesn't belong to the rewind context many times
+	const blind = randomBytes(32);
+	const proof = secp256k1Zkp["createBulletproof"](blind, "1", randomBytes(32), randomBytes(32), new Uint8Array([]), new Uint8Array(20));
+	const commit = secp256k1Zkp["pedersenCommit"](blind, "1");
+	const proofs = new Array(NUMBER_OF_BULK_PROOFS).fill(proof);
+	const commits = new Uint8Array(commit.length * NUMBER_OF_BULK_PROOFS);
+	for(let i = 0; i < NUMBER_OF_BULK_PROOFS; ++i) {
+	
+		// Add commit to the commits
+		commits.set(commit, i * commit.length);
+	}
+	const rewindContext = secp256k1Zkp["createRewindContext"](randomBytes(32));
+	
+	// Measure interactive latency while idle
+	const results = [await measureInteractiveLatency("idle")];
+	
+	// Start bulk scans that occupy every bulk thread
+	const abortController = new AbortController();
+	const bulkScans = [];
+	for(let i = 0; i < NUMBER_OF_BULK_SCANS; ++i) {
+	
+		// Start bulk scan
+		bulkScans.push(rewindContext.scan(proofs, commits, function() {}, abortController["signal"]));
+	}
+	
+	// Measure interactive latency while the bulk scans are running
+	results.push(await measureInteractiveLatency(NUMBER_OF_BULK_SCANS.toString() + " bulk scans"));
+	
+	// Abort bulk scans and wait for them to stop
+	abortController.abort();
+	await Promise.all(bulkScans);
+	
+	// Display results
+	console.log(NUMBER_OF_INTERACTIVE_TASKS.toString() + " interactive tasks, " + process.arch + ", " + os.cpus()[0]["model"] + ", " + os.cpus().length.toString() + " cores");
+	console.table(results);
+})();
@@ -0,0 +1,121 @@
+// Use strict
+"use strict";
+
+
+// Requires
+
+// Crypto
+const crypto = require("crypto");
+
+// OS
+const os = require("os");
+
+// Secp256k1-zkp
+const secp256k1Zkp = require("../index.js");
+
+
+// Constants
+
+// Number of iterations
+const NUMBER_OF_ITERATIONS = parseInt(process.argv[2] || "5000", 10);
+
+// Number of different inputs to cycle through
+const NUMBER_OF_INPUTS = 64;
+
+// Value
+const VALUE = "1000";
+
+
+// Supporting function implementation
+
+// Random bytes
+const randomBytes = function(size) {
+
+	// Return random bytes
+	return new Uint8Array(crypto.randomBytes(size));
+};
+
+// Measure
+const measure = function(name, run) {
+
+	// Warm up and check that every input works
+	for(let i = 0; i < NUMBER_OF_INPUTS; ++i) {
+	
+		// Check if running with the input failed
+		if(run(i) === secp256k1Zkp["OPERATION_FAILED"]) {
+		
+			// Throw error
+			throw new Error(name + " failed");
+		}
+	}
+	
+	// Go through all iterations
+	const start = process.hrtime.bigint();
+	for(let i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Run with the next input
+		run(i % NUMBER_OF_INPUTS);
+	}
+	const elapsed = Number(process.hrtime.bigint() - start) / 1000;
+	
+	// Return result
+	return {
+	
+		// Function
+		"Function": name,
+		
+		// Microseconds per operation
+		"µs/op": (elapsed / NUMBER_OF_ITERATIONS).toFixed(2),
+		
+		// Operations per second
+		"ops/s": Math.round(NUMBER_OF_ITERATIONS / elapsed * 1000000)
+	};
+};
+
+
+// Main function
+
+// Create secret keys, their public keys, and messages
+const secretKeys = Array.from({"length": NUMBER_OF_INPUTS}, function() {
+
+	// Return random secret key
+	return randomBytes(32);
+});
+const publicKeys = secretKeys.map(function(secretKey) {
+
+	// Return secret key's public key
+	return secp256k1Zkp["publicKeyFromSecretKey"](secretKey);
+});
+const messages = Array.from({"length": NUMBER_OF_INPUTS}, function() {
+
+	// Return random message
+	return randomBytes(32);
+});
+
+// Go through all functions that use the ecmult gen table
+const results = [
+	measure("publicKeyFromSecretKey", function(i) {
+	
+		// Return getting the secret key's public key
+		return secp256k1Zkp["publicKeyFromSecretKey"](secretKeys[i]);
+	}),
+	measure("pedersenCommit", function(i) {
+	
+		// Return committing to the value with the secret key as the blind
+		return secp256k1Zkp["pedersenCommit"](secretKeys[i], VALUE);
+	}),
+	measure("createSecretNonce", function(i) {
+	
+		// Return creating a secret nonce
+		return secp256k1Zkp["createSecretNonce"]();
+	}),
+	measure("createSingleSignerSignature", function(i) {
+	
+		// Return signing the message
+		return secp256k1Zkp["createSingleSignerSignature"](messages[i], secretKeys[i], null, publicKeys[i], null, null);
+	})
+];
+
+// Display results
+console.log(NUMBER_OF_ITERATIONS.toString() + " iterations, " + process.arch + ", " + os.cpus()[0]["model"]);
+console.table(results);
@@ -0,0 +1,130 @@
+// Use strict
+"use strict";
+
+
+// Requires
+
+// Crypto
+const crypto = require("crypto");
+
+// OS
+const os = require("os");
+
+// Secp256k1-zkp
+const secp256k1Zkp = require("../index.js");
+
+
+// Constants
+
+// Number of iterations
+const NUMBER_OF_ITERATIONS = parseInt(process.argv[2] || "2000", 10);
+
+// Number of different inputs to cycle through
+const NUMBER_OF_INPUTS = 64;
+
+// Value
+const VALUE = "1000";
+
+
+// Supporting function implementation
+
+// Random bytes
+const randomBytes = function(size) {
+
+	// Return random bytes
+	return new Uint8Array(crypto.randomBytes(size));
+};
+
+// Measure
+const measure = function(name, inputs, run) {
+
+	// Warm up and check that every input verifies
+	for(const input of inputs) {
+	
+		// Check if input doesn't verify
+		if(run(input) !== true) {
+		
+			// Throw error
+			throw new Error(name + " failed");
+		}
+	}
+	
+	// Go through all iterations
+	const start = process.hrtime.bigint();
+	for(let i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Run with the next input
+		run(inputs[i % inputs.length]);
+	}
+	const elapsed = Number(process.hrtime.bigint() - start) / 1000;
+	
+	// Return result
+	return {
+	
+		// Function
+		"Function": name,
+		
+		// Microseconds per operation
+		"µs/op": (elapsed / NUMBER_OF_ITERATIONS).toFixed(2),
+		
+		// Operations per second
+		"ops/s": Math.round(NUMBER_OF_ITERATIONS / elapsed * 1000000)
+	};
+};
+
+
+// Main function
+
+// Disable the caches so that every iteration is a full verification
+secp256k1Zkp["setProofCacheCapacity"](0);
+secp256k1Zkp["setSignatureCacheEnabled"](false);
+
+// Create single-signer signatures
+const singleSignerSignatures = Array.from({"length": NUMBER_OF_INPUTS}, function() {
+
+	// Return signature, message, and public key
+	const secretKey = randomBytes(32);
+	const publicKey = secp256k1Zkp["publicKeyFromSecretKey"](secretKey);
+	const message = randomBytes(32);
+	return [secp256k1Zkp["createSingleSignerSignature"](message, secretKey, null, publicKey, null, null), message, publicKey];
+});
+
+// Create message hash signatures
+const messageHashSignatures = Array.from({"length": NUMBER_OF_INPUTS}, function() {
+
+	// Return signature, message hash, and public key
+	const secretKey = randomBytes(32);
+	const messageHash = randomBytes(32);
+	return [secp256k1Zkp["createMessageHashSignature"](messageHash, secretKey), messageHash, secp256k1Zkp["publicKeyFromSecretKey"](secretKey)];
+});
+
+// Create bulletproofs
+const bulletproofs = Array.from({"length": NUMBER_OF_INPUTS}, function() {
+
+	// Return proof and commit
+	const blind = randomBytes(32);
+	return [secp256k1Zkp["createBulletproof"](blind, VALUE, randomBytes(32), randomBytes(32), new Uint8Array([]), new Uint8Array(20)), secp256k1Zkp["pedersenCommit"](blind, VALUE)];
+});
+
+// Go through all verify functions
+const results = [
+	measure("verifySingleSignerSignature", singleSignerSignatures, function(input) {
+	
+		// Return verifying the single-signer signature
+		return secp256k1Zkp["verifySingleSignerSignature"](input[0], input[1], null, input[2], input[2], false);
+	}),
+	measure("verifyMessageHashSignature", messageHashSignatures, function(input) {
+	
+		// Return verifying the message hash signature
+		return secp256k1Zkp["verifyMessageHashSignature"](input[0], input[1], input[2]);
+	}),
+	measure("verifyBulletproof", bulletproofs, function(input) {
+	
+		// Return verifying the bulletproof
+		return secp256k1Zkp["verifyBulletproof"](input[0], input[1], new Uint8Array([]));
+	})
+];
+
+// Display results and the context's memory which includes the verify tables
+console.log(NUMBER_OF_ITERATIONS.toString() + " iterations, " + process.arch + ", " + os.cpus()[0]["model"] + ", context memory " + (secp256k1Zkp["getMemoryUsage"]()["Context"] / 1024).toFixed(0) + " KiB");
+console.table(results);
@@ -1,10 +1,14 @@
 {
+	"variables": {
+		"enable_bulletproof%": 1,
+		"ecmult_gen_precision%": 0
+	},
 	"targets": [
 		{
 			"target_name": "secp256k1_zkp",
 			"sources": [
 				"./main.cpp",
-				"./secp256k1-zkp-master/src/secp256k1.c"
+				"./internals.c"
 			],
 			"include_dirs": [
 				"./secp256k1-zkp-master/",
@@ -22,9 +26,66 @@
 				"ENABLE_MODULE_ECDH",
 				"ENABLE_MODULE_GENERATOR",
 				"ENABLE_MODULE_COMMITMENT",
-				"ENABLE_MODULE_BULLETPROOF",
 				"ENABLE_MODULE_AGGSIG"
+			],
+			"conditions": [
+				["enable_bulletproof==1", {
+					"defines": [
+						"ENABLE_MODULE_BULLETPROOF"
+					]
+				}],
+				["ecmult_gen_precision!=0", {
+					"dependencies": [
+						"gen_context#host"
+					],
+					"actions": [
+						{
+							"action_name": "generate_ecmult_static_context",
+							"inputs": [
+								"./gen_context.js",
+								"<(PRODUCT_DIR)/<(EXECUTABLE_PREFIX)gen_context<(EXECUTABLE_SUFFIX)"
+							],
+							"outputs": [
+								"<(SHARED_INTERMEDIATE_DIR)/src/ecmult_static_context.h"
+							],
+							"action": [
+								"node",
+								"./gen_context.js",
+								"<(PRODUCT_DIR)/<(EXECUTABLE_PREFIX)gen_context<(EXECUTABLE_SUFFIX)",
+								"<(SHARED_INTERMEDIATE_DIR)"
+							]
+						}
+					],
+					"include_dirs+": [
+						"<(SHARED_INTERMEDIATE_DIR)/src/"
+					],
+					"defines": [
+						"ECMULT_GEN_PREC_BITS=<(ecmult_gen_precision)"
+					]
+				}]
 			]
 		}
+	],
+	"conditions": [
+		["ecmult_gen_precision!=0", {
+			"targets": [
+				{
+					"target_name": "gen_context",
+					"type": "executable",
+					"toolset": "host",
+					"sources": [
+						"./secp256k1-zkp-master/src/gen_context.c"
+					],
+					"include_dirs": [
+						"./secp256k1-zkp-master/",
+						"./secp256k1-zkp-master/src/",
+						"./secp256k1-zkp-master/include/"
+					],
+					"defines": [
+						"ECMULT_GEN_PREC_BITS=<(ecmult_gen_precision)"
+					]
+				}
+			]
+		}]
 	]
 }
@@ -0,0 +1,28 @@
+// Use strict
+"use strict";
+
+
+// Requires
+
+// Child process
+const childProcess = require("child_process");
+
+// File system
+const fs = require("fs");
+
+// Path
+const path = require("path");
+
+
+// Main function
+
+// Get the gen_context executable and the directory to generate the ecmult static context in
+const genContext = path.resolve(process.argv[2]);
+const outputDirectory = path.resolve(process.argv[3]);
+
+// Create the source directory that gen_context writes src/ecmult_static_context.h to
+fs.mkdirSync(path.join(outputDirectory, "src"), {"recursive": true});
+
+// Run gen_context from the output directory and exit with its status
+const result = childProcess.spawnSync(genContext, [], {"cwd": outputDirectory, "stdio": "inherit"});
+process.exit((result["status"] === null) ? 1 : result["status"]);
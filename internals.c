@@ -0,0 +1,1754 @@
+// Check if ecmult gen precision is provided
+#ifdef ECMULT_GEN_PREC_BITS
+
+	// Header files
+	#include "ecmult_gen.h"
+	
+	// Include the ecmult static context generated for the ecmult gen precision first so that its include guard skips the published one next to the library's sources
+	#include <ecmult_static_context.h>
+#endif
+
+// Header files
+#include "secp256k1.c"
+#include "./internals.h"
+
+// Check if ecmult gen precision is provided
+#ifdef ECMULT_GEN_PREC_BITS
+
+	// Check if ecmult gen precision is invalid
+	#if ECMULT_GEN_PREC_BITS != 2 && ECMULT_GEN_PREC_BITS != 4 && ECMULT_GEN_PREC_BITS != 8
+		#error "ecmult_gen_precision must be 2, 4, or 8"
+	#endif
+	
+	// Check if secp256k1-zkp doesn't build its sign tables with the ecmult gen precision
+	#if !defined(ECMULT_GEN_PREC_B) || ECMULT_GEN_PREC_B != ECMULT_GEN_PREC_BITS
+		#error "secp256k1-zkp doesn't support ecmult_gen_precision"
+	#endif
+#endif
+
+// Check if compiler can target AVX2 for x86 functions
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+
+	// AVX2 supported
+	#define AVX2_SUPPORTED
+	
+	// Header files
+	#include <immintrin.h>
+	
+	// Check if using the 10x26 field representation
+	#ifdef USE_FIELD_10X26
+	
+		// Field AVX2 supported
+		#define FIELD_AVX2_SUPPORTED
+	#endif
+#endif
+
+
+// Definitions
+
+// Commit size
+#define COMMIT_SIZE 33
+
+// Rewind nonce size
+#define REWIND_NONCE_SIZE 32
+
+// Bulletproof minimum proof size
+#define BULLETPROOF_MINIMUM_PROOF_SIZE (64 + 128 + 1)
+
+// Bulletproof encoded value and message padding size
+#define BULLETPROOF_ENCODED_PADDING_SIZE 4
+
+// Bulletproof message size
+#define BULLETPROOF_MESSAGE_SIZE 20
+
+// Verification cache salt size
+#define VERIFICATION_CACHE_SALT_SIZE 32
+
+// SHA-256 lanes
+#define SHA256_LANES 8
+
+// Bulletproof rewind challenge message size
+#define BULLETPROOF_REWIND_CHALLENGE_MESSAGE_SIZE (32 + 1 + 32 + 32)
+
+// Compressed point size
+#define COMPRESSED_POINT_SIZE 33
+
+// Field lanes
+#define FIELD_LANES 4
+
+// Field limbs
+#define FIELD_LIMBS 10
+
+// Field limb bits
+#define FIELD_LIMB_BITS 26
+
+// Field limb mask
+#define FIELD_LIMB_MASK 0x3FFFFFF
+
+// Field top limb bits
+#define FIELD_TOP_LIMB_BITS 22
+
+// Field top limb mask
+#define FIELD_TOP_LIMB_MASK 0x3FFFFF
+
+// Field reduction low which is the part of 2^260 mod p that stays in the same limb
+#define FIELD_REDUCTION_LOW 0x3D10
+
+// Field reduction high which is the part of 2^260 mod p that goes in the next limb
+#define FIELD_REDUCTION_HIGH 0x400
+
+// Field overflow low which is the part of 2^256 mod p that stays in the first limb
+#define FIELD_OVERFLOW_LOW 0x3D1
+
+// Field overflow high bits which is the shift of the part of 2^256 mod p that goes in the second limb
+#define FIELD_OVERFLOW_HIGH_BITS 6
+
+// Field AVX2 state unknown
+#define FIELD_AVX2_STATE_UNKNOWN 0
+
+// Field AVX2 state usable
+#define FIELD_AVX2_STATE_USABLE 1
+
+// Field AVX2 state unusable
+#define FIELD_AVX2_STATE_UNUSABLE 2
+
+
+// Constants
+
+// SHA-256 initial state
+static const uint32_t SHA256_INITIAL_STATE[] = {
+	0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+};
+
+// SHA-256 round constants
+static const uint32_t SHA256_ROUND_CONSTANTS[] = {
+	0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+	0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+	0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+	0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+	0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+	0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+	0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+	0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+// Field AVX2 self-test values which include small values, p - 1, and values with every limb full to exercise the carries
+static const uint8_t FIELD_AVX2_SELF_TEST_VALUES[FIELD_LANES][32] = {
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08},
+	{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0x2E},
+	{0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+	{0x79, 0xBE, 0x66, 0x7E, 0xF9, 0xDC, 0xBB, 0xAC, 0x55, 0xA0, 0x62, 0x95, 0xCE, 0x87, 0x0B, 0x07, 0x02, 0x9B, 0xFC, 0xDB, 0x2D, 0xCE, 0x28, 0xD9, 0x59, 0xF2, 0x81, 0x5B, 0x16, 0xF8, 0x17, 0x98}
+};
+
+
+// Structures
+
+// Bulletproof rewind cache
+struct BulletproofRewindCache {
+
+	// Alpha
+	secp256k1_scalar alpha;
+	
+	// Rho
+	secp256k1_scalar rho;
+	
+	// Tau one
+	secp256k1_scalar tau1;
+	
+	// Tau two
+	secp256k1_scalar tau2;
+	
+	// Value generator x
+	uint8_t valueGeneratorX[32];
+	
+	// Value generator parity
+	uint8_t valueGeneratorParity;
+};
+
+// Multi-scalar multiply data
+typedef struct {
+
+	// Context
+	const secp256k1_context *context;
+	
+	// Points
+	const secp256k1_pubkey *points;
+	
+	// Scalars
+	const secp256k1_scalar *scalars;
+} MultiScalarMultiplyData;
+
+// Check if field AVX2 is supported
+#ifdef FIELD_AVX2_SUPPORTED
+
+	// Field AVX2 with each of the four lanes' limbs in a different 64-bit element
+	typedef struct {
+	
+		// Limbs
+		__m256i n[FIELD_LIMBS];
+	} FieldAvx2;
+#endif
+
+
+// Global variables
+
+// Check if field AVX2 is supported
+#ifdef FIELD_AVX2_SUPPORTED
+
+	// Field AVX2 state
+	static int fieldAvx2State = FIELD_AVX2_STATE_UNKNOWN;
+#endif
+
+
+// Function prototypes
+
+// Bulletproof rewind cache initialize
+static void bulletproofRewindCacheInitialize(BulletproofRewindCache *cache, const uint8_t *nonce);
+
+// Bulletproof rewind cache clear
+static void bulletproofRewindCacheClear(BulletproofRewindCache *cache);
+
+// Multi-scalar multiply callback
+static int multiScalarMultiplyCallback(secp256k1_scalar *scalar, secp256k1_ge *point, size_t index, void *data);
+
+// Bulletproof rewind precheck format
+static bool bulletproofRewindPrecheckFormat(const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize);
+
+// Bulletproof rewind precheck finish
+static bool bulletproofRewindPrecheckFinish(const BulletproofRewindCache *cache, const uint8_t *proof, const uint8_t *challenge);
+
+// Bulletproof rewind challenge message
+static void bulletproofRewindChallengeMessage(uint8_t *message, const uint8_t *challenge, uint8_t parity, const uint8_t *first, const uint8_t *second);
+
+// Check if AVX2 is supported
+#ifdef AVX2_SUPPORTED
+
+	// SHA-256 AVX2 rotate right
+	__attribute__((target("avx2"))) static inline __m256i sha256Avx2RotateRight(__m256i value, int bits);
+	
+	// SHA-256 multiple AVX2
+	__attribute__((target("avx2"))) static void sha256MultipleAvx2(uint8_t (*hashes)[32], const uint8_t *const *messages, size_t messageSize);
+#endif
+
+// Are quadratic residues
+static void areQuadraticResidues(const secp256k1_fe *values, size_t numberOfValues, bool *results);
+
+// Check if field AVX2 is supported
+#ifdef FIELD_AVX2_SUPPORTED
+
+	// Field AVX2 usable
+	static bool fieldAvx2Usable(void);
+	
+	// Field AVX2 self-test
+	__attribute__((target("avx2"))) static bool fieldAvx2SelfTest(void);
+	
+	// Field AVX2 load
+	__attribute__((target("avx2"))) static void fieldAvx2Load(FieldAvx2 *result, const secp256k1_fe *values);
+	
+	// Field AVX2 store
+	__attribute__((target("avx2"))) static void fieldAvx2Store(secp256k1_fe *results, const FieldAvx2 *value);
+	
+	// Field AVX2 reduce
+	__attribute__((target("avx2"))) static void fieldAvx2Reduce(FieldAvx2 *result, __m256i *product);
+	
+	// Field AVX2 multiply
+	__attribute__((target("avx2"))) static void fieldAvx2Multiply(FieldAvx2 *result, const FieldAvx2 *first, const FieldAvx2 *second);
+	
+	// Field AVX2 square
+	__attribute__((target("avx2"))) static void fieldAvx2Square(FieldAvx2 *result, const FieldAvx2 *value);
+	
+	// Field AVX2 square multiple
+	__attribute__((target("avx2"))) static void fieldAvx2SquareMultiple(FieldAvx2 *result, const FieldAvx2 *value, int numberOfSquares);
+	
+	// Field AVX2 are quadratic residues
+	__attribute__((target("avx2"))) static void fieldAvx2AreQuadraticResidues(const secp256k1_fe *values, bool *results);
+#endif
+
+
+// Supporting function implementation
+
+// Bulletproof rewind precheck
+bool bulletproofRewindPrecheck(const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize, const uint8_t *nonce, size_t nonceSize) {
+
+	// Check if nonce has an invalid size
+	if(nonceSize != REWIND_NONCE_SIZE) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Initialize cache
+	BulletproofRewindCache cache;
+	bulletproofRewindCacheInitialize(&cache, nonce);
+	
+	// Perform precheck with the cache
+	const bool result = bulletproofRewindCachePrecheck(&cache, proof, proofSize, commit, commitSize);
+	
+	// Clear cache
+	bulletproofRewindCacheClear(&cache);
+	
+	// Return result
+	return result;
+}
+
+// Bulletproof rewind cache create
+BulletproofRewindCache *bulletproofRewindCacheCreate(const uint8_t *nonce, size_t nonceSize) {
+
+	// Check if nonce has an invalid size
+	if(nonceSize != REWIND_NONCE_SIZE) {
+	
+		// Return nothing
+		return NULL;
+	}
+	
+	// Check if allocating memory for the cache failed
+	BulletproofRewindCache *cache = malloc(sizeof(BulletproofRewindCache));
+	if(!cache) {
+	
+		// Return nothing
+		return NULL;
+	}
+	
+	// Initialize cache
+	bulletproofRewindCacheInitialize(cache, nonce);
+	
+	// Return cache
+	return cache;
+}
+
+// Bulletproof rewind cache destroy
+void bulletproofRewindCacheDestroy(BulletproofRewindCache *cache) {
+
+	// Clear cache
+	bulletproofRewindCacheClear(cache);
+	
+	// Free memory
+	free(cache);
+}
+
+// Bulletproof rewind cache precheck
+bool bulletproofRewindCachePrecheck(const BulletproofRewindCache *cache, const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize) {
+
+	// Return performing precheck on the proof by itself
+	bool result;
+	bulletproofRewindCachePrecheckMultiple(cache, &proof, &proofSize, &commit, &commitSize, 1, &result);
+	return result;
+}
+
+// Bulletproof rewind cache precheck multiple
+void bulletproofRewindCachePrecheckMultiple(const BulletproofRewindCache *cache, const uint8_t *const *proofs, const size_t *proofSizes, const uint8_t *const *commits, const size_t *commitSizes, size_t numberOfProofs, bool *results) {
+
+	// Go through all proofs
+	for(size_t i = 0; i < numberOfProofs;) {
+	
+		// Go through proofs until a group of them that are formatted correctly fills all SHA-256 lanes
+		size_t group[SHA256_LANES];
+		size_t groupSize = 0;
+		for(; i < numberOfProofs && groupSize < SHA256_LANES; ++i) {
+		
+			// Check if proof and commit are formatted correctly
+			results[i] = bulletproofRewindPrecheckFormat(proofs[i], proofSizes[i], commits[i], commitSizes[i]);
+			if(results[i]) {
+			
+				// Add proof to the group
+				group[groupSize++] = i;
+			}
+		}
+		
+		// Go through all proofs in the group
+		uint8_t messages[SHA256_LANES][BULLETPROOF_REWIND_CHALLENGE_MESSAGE_SIZE];
+		uint8_t challenges[SHA256_LANES][32];
+		for(size_t j = 0; j < groupSize; ++j) {
+		
+			// Get challenge message from the serialized commit's parity and x component without decompressing it
+			const uint8_t *commit = commits[group[j]];
+			memset(challenges[j], 0, sizeof(challenges[j]));
+			bulletproofRewindChallengeMessage(messages[j], challenges[j], ((commit[0] & 1) << 1) | cache->valueGeneratorParity, &commit[1], cache->valueGeneratorX);
+		}
+		
+		// Get challenges by hashing all of the group's challenge messages together
+		sha256Multiple(challenges[0], messages[0], BULLETPROOF_REWIND_CHALLENGE_MESSAGE_SIZE, groupSize);
+		
+		// Go through the y and z challenges
+		for(int k = 0; k < 2; ++k) {
+		
+			// Go through all proofs in the group
+			for(size_t j = 0; j < groupSize; ++j) {
+			
+				// Get challenge message from the proof's A and S components
+				const uint8_t *proof = proofs[group[j]];
+				bulletproofRewindChallengeMessage(messages[j], challenges[j], 2 * !!(proof[64] & 1) + !!(proof[64] & 2), &proof[65], &proof[65 + 32]);
+			}
+			
+			// Get challenges by hashing all of the group's challenge messages together
+			sha256Multiple(challenges[0], messages[0], BULLETPROOF_REWIND_CHALLENGE_MESSAGE_SIZE, groupSize);
+		}
+		
+		// Go through all proofs in the group
+		for(size_t j = 0; j < groupSize; ++j) {
+		
+			// Check if z challenge is invalid
+			int overflow;
+			secp256k1_scalar z;
+			secp256k1_scalar_set_b32(&z, challenges[j], &overflow);
+			if(overflow || secp256k1_scalar_is_zero(&z)) {
+			
+				// Set proof's result to false
+				results[group[j]] = false;
+			}
+			
+			// Get challenge message from the proof's T1 and T2 components
+			const uint8_t *proof = proofs[group[j]];
+			bulletproofRewindChallengeMessage(messages[j], challenges[j], 2 * !!(proof[64] & 4) + !!(proof[64] & 8), &proof[129], &proof[129 + 32]);
+		}
+		
+		// Get x challenges by hashing all of the group's challenge messages together
+		sha256Multiple(challenges[0], messages[0], BULLETPROOF_REWIND_CHALLENGE_MESSAGE_SIZE, groupSize);
+		
+		// Go through all proofs in the group
+		for(size_t j = 0; j < groupSize; ++j) {
+		
+			// Check if proof's z challenge was valid
+			if(results[group[j]]) {
+			
+				// Set proof's result to if finishing its precheck with its x challenge was successful
+				results[group[j]] = bulletproofRewindPrecheckFinish(cache, proofs[group[j]], challenges[j]);
+			}
+		}
+	}
+}
+
+// Bulletproof rewind cache rewind
+bool bulletproofRewindCacheRewind(const secp256k1_context *context, const BulletproofRewindCache *cache, uint64_t *value, uint8_t *blind, uint8_t *message, const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize) {
+
+	// Check if proof and commit aren't formatted correctly
+	if(!bulletproofRewindPrecheckFormat(proof, proofSize, commit, commitSize)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if parsing commit failed
+	secp256k1_pedersen_commitment commitment;
+	if(!secp256k1_pedersen_commitment_parse(context, &commitment, commit)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Get y challenge from the serialized commit's parity and x component and the proof's A and S components
+	uint8_t challengeMessage[BULLETPROOF_REWIND_CHALLENGE_MESSAGE_SIZE];
+	uint8_t challenge[32] = {0};
+	bulletproofRewindChallengeMessage(challengeMessage, challenge, ((commit[0] & 1) << 1) | cache->valueGeneratorParity, &commit[1], cache->valueGeneratorX);
+	sha256Multiple(challenge, challengeMessage, sizeof(challengeMessage), 1);
+	bulletproofRewindChallengeMessage(challengeMessage, challenge, 2 * !!(proof[64] & 1) + !!(proof[64] & 2), &proof[65], &proof[65 + 32]);
+	sha256Multiple(challenge, challengeMessage, sizeof(challengeMessage), 1);
+	
+	// Check if z challenge is invalid
+	bulletproofRewindChallengeMessage(challengeMessage, challenge, 2 * !!(proof[64] & 1) + !!(proof[64] & 2), &proof[65], &proof[65 + 32]);
+	sha256Multiple(challenge, challengeMessage, sizeof(challengeMessage), 1);
+	int overflow;
+	secp256k1_scalar z;
+	secp256k1_scalar_set_b32(&z, challenge, &overflow);
+	if(overflow || secp256k1_scalar_is_zero(&z)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if x challenge is invalid
+	bulletproofRewindChallengeMessage(challengeMessage, challenge, 2 * !!(proof[64] & 4) + !!(proof[64] & 8), &proof[129], &proof[129 + 32]);
+	sha256Multiple(challenge, challengeMessage, sizeof(challengeMessage), 1);
+	secp256k1_scalar x;
+	secp256k1_scalar_set_b32(&x, challenge, &overflow);
+	if(overflow || secp256k1_scalar_is_zero(&x)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Recover the encoded value and message by adding the cached alpha and rho * x to the proof's negated mu
+	secp256k1_scalar mu;
+	secp256k1_scalar_set_b32(&mu, &proof[32], NULL);
+	secp256k1_scalar temp;
+	secp256k1_scalar_mul(&temp, &cache->rho, &x);
+	secp256k1_scalar_add(&mu, &mu, &temp);
+	secp256k1_scalar_add(&mu, &mu, &cache->alpha);
+	uint8_t encoded[32];
+	secp256k1_scalar_get_b32(encoded, &mu);
+	
+	// Check if encoded value and message isn't padded correctly
+	static const uint8_t padding[BULLETPROOF_ENCODED_PADDING_SIZE] = {0};
+	if(memcmp(encoded, padding, sizeof(padding))) {
+	
+		// Clear secrets
+		secp256k1_scalar_clear(&temp);
+		secp256k1_scalar_clear(&mu);
+		memset(encoded, 0, sizeof(encoded));
+		
+		// Return false
+		return false;
+	}
+	
+	// Get value from the end of the encoded value and message
+	uint64_t encodedValue = 0;
+	for(size_t i = sizeof(encoded) - sizeof(encodedValue); i < sizeof(encoded); ++i) {
+	
+		// Add byte to the value
+		encodedValue = (encodedValue << 8) | encoded[i];
+	}
+	
+	// Recover the blind from the proof's tau x using the cached tau one and tau two with blind = (tau x - tau one * x - tau two * x^2) / z^2
+	secp256k1_scalar blindScalar;
+	secp256k1_scalar_set_b32(&blindScalar, &proof[0], NULL);
+	secp256k1_scalar_mul(&temp, &cache->tau2, &x);
+	secp256k1_scalar_add(&temp, &temp, &cache->tau1);
+	secp256k1_scalar_mul(&temp, &temp, &x);
+	secp256k1_scalar_negate(&temp, &temp);
+	secp256k1_scalar_add(&blindScalar, &blindScalar, &temp);
+	secp256k1_scalar_sqr(&z, &z);
+	secp256k1_scalar_inverse_var(&z, &z);
+	secp256k1_scalar_mul(&blindScalar, &blindScalar, &z);
+	
+	// Check if the value and blind don't open the commit
+	secp256k1_ge valueGenerator;
+	secp256k1_generator_load(&valueGenerator, &secp256k1_generator_const_h);
+	secp256k1_ge commitPoint;
+	secp256k1_pedersen_commitment_load(&commitPoint, &commitment);
+	secp256k1_gej check;
+	secp256k1_pedersen_ecmult(&check, &blindScalar, encodedValue, &valueGenerator, &secp256k1_ge_const_g);
+	secp256k1_gej_neg(&check, &check);
+	secp256k1_gej_add_ge_var(&check, &check, &commitPoint, NULL);
+	if(!secp256k1_gej_is_infinity(&check)) {
+	
+		// Clear secrets
+		secp256k1_scalar_clear(&temp);
+		secp256k1_scalar_clear(&mu);
+		memset(encoded, 0, sizeof(encoded));
+		secp256k1_scalar_clear(&blindScalar);
+		encodedValue = 0;
+		
+		// Return false
+		return false;
+	}
+	
+	// Set value, blind, and message
+	*value = encodedValue;
+	secp256k1_scalar_get_b32(blind, &blindScalar);
+	memcpy(message, &encoded[BULLETPROOF_ENCODED_PADDING_SIZE], BULLETPROOF_MESSAGE_SIZE);
+	
+	// Clear secrets
+	secp256k1_scalar_clear(&temp);
+	secp256k1_scalar_clear(&mu);
+	memset(encoded, 0, sizeof(encoded));
+	secp256k1_scalar_clear(&blindScalar);
+	encodedValue = 0;
+	
+	// Return true
+	return true;
+}
+
+// Is valid compressed point
+bool isValidCompressedPoint(const uint8_t *point, uint8_t evenPrefix) {
+
+	// Return checking the point by itself
+	bool result;
+	areValidCompressedPoints(point, 1, evenPrefix, &result);
+	return result;
+}
+
+// Are valid compressed points
+void areValidCompressedPoints(const uint8_t *points, size_t numberOfPoints, uint8_t evenPrefix, bool *results) {
+
+	// Go through all points
+	for(size_t i = 0; i < numberOfPoints;) {
+	
+		// Go through points until a group of them with valid x components fills all field lanes
+		size_t group[FIELD_LANES];
+		secp256k1_fe curves[FIELD_LANES];
+		size_t groupSize = 0;
+		for(; i < numberOfPoints && groupSize < FIELD_LANES; ++i) {
+		
+			// Check if point has a valid prefix and its x component is a valid field element
+			const uint8_t *point = &points[i * COMPRESSED_POINT_SIZE];
+			secp256k1_fe x;
+			results[i] = (point[0] & 0xFE) == evenPrefix && secp256k1_fe_set_b32(&x, &point[1]);
+			if(results[i]) {
+			
+				// Get x^3 + 7
+				secp256k1_fe b;
+				secp256k1_fe_sqr(&curves[groupSize], &x);
+				secp256k1_fe_mul(&curves[groupSize], &curves[groupSize], &x);
+				secp256k1_fe_set_int(&b, CURVE_B);
+				secp256k1_fe_add(&curves[groupSize], &b);
+				
+				// Add point to the group
+				group[groupSize++] = i;
+			}
+		}
+		
+		// Check if the group's x^3 + 7 values are quadratic residues which means that y components exist without computing them
+		bool residues[FIELD_LANES];
+		areQuadraticResidues(curves, groupSize, residues);
+		
+		// Go through all points in the group
+		for(size_t j = 0; j < groupSize; ++j) {
+		
+			// Set point's result to if it has a y component
+			results[group[j]] = residues[j];
+		}
+	}
+}
+
+// Single-signer challenge
+void singleSignerChallenge(const secp256k1_context *context, uint8_t *challenge, const secp256k1_pubkey *publicNonceTotal, const secp256k1_pubkey *publicKeyTotal, const uint8_t *message) {
+
+	// Get challenge from the public nonce total, public key total, and message
+	secp256k1_scalar e;
+	secp256k1_compute_sighash_single(context, &e, publicNonceTotal, publicKeyTotal, message);
+	secp256k1_scalar_get_b32(challenge, &e);
+}
+
+// Verify partial single-signer signature
+bool verifyPartialSingleSignerSignature(const secp256k1_context *context, const uint8_t *signature, const uint8_t *challenge, const secp256k1_pubkey *publicKey, const secp256k1_pubkey *publicNonce, const secp256k1_pubkey *publicNonceTotal) {
+
+	// Check if signature's s component is invalid
+	int overflow;
+	secp256k1_scalar s;
+	secp256k1_scalar_set_b32(&s, &signature[32], &overflow);
+	if(overflow) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if signature's r component is invalid
+	secp256k1_fe r;
+	if(!secp256k1_fe_set_b32(&r, signature)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if loading public key, public nonce, or public nonce total failed
+	secp256k1_ge publicKeyAffine;
+	secp256k1_ge publicNonceAffine;
+	secp256k1_ge publicNonceTotalAffine;
+	if(!secp256k1_pubkey_load(context, &publicKeyAffine, publicKey) || !secp256k1_pubkey_load(context, &publicNonceAffine, publicNonce) || !secp256k1_pubkey_load(context, &publicNonceTotalAffine, publicNonceTotal)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if signature's r component isn't the public nonce's x component
+	secp256k1_fe_normalize_var(&publicNonceAffine.x);
+	if(!secp256k1_fe_equal_var(&r, &publicNonceAffine.x)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Get s * G - challenge * public key
+	secp256k1_scalar negatedChallenge;
+	secp256k1_scalar_set_b32(&negatedChallenge, challenge, NULL);
+	secp256k1_scalar_negate(&negatedChallenge, &negatedChallenge);
+	secp256k1_gej publicKeyJacobian;
+	secp256k1_gej_set_ge(&publicKeyJacobian, &publicKeyAffine);
+	secp256k1_gej result;
+	secp256k1_ecmult(&context->ecmult_ctx, &result, &publicKeyJacobian, &negatedChallenge, &s);
+	
+	// Check if signers didn't negate their nonces since the public nonce total's y component is a quadratic residue
+	secp256k1_fe_normalize_var(&publicNonceTotalAffine.y);
+	if(secp256k1_fe_is_quad_var(&publicNonceTotalAffine.y)) {
+	
+		// Negate the public nonce so that adding it removes it from the result
+		secp256k1_ge_neg(&publicNonceAffine, &publicNonceAffine);
+	}
+	
+	// Return if the result is the public nonce or the negated public nonce if signers negated their nonces like the batch verification requires
+	secp256k1_gej_add_ge_var(&result, &result, &publicNonceAffine, NULL);
+	return secp256k1_gej_is_infinity(&result);
+}
+
+// Verify partial single-signer signatures
+bool verifyPartialSingleSignerSignatures(const secp256k1_context *context, secp256k1_scratch_space *scratchSpace, const uint8_t *signatures, size_t numberOfSignatures, const uint8_t *challenge, const secp256k1_pubkey *publicKeys, const secp256k1_pubkey *publicNonces, const secp256k1_pubkey *publicNonceTotal, const uint8_t *seed) {
+
+	// Check if no signatures were provided
+	if(!numberOfSignatures) {
+	
+		// Return true
+		return true;
+	}
+	
+	// Check if loading public nonce total failed
+	secp256k1_ge publicNonceTotalAffine;
+	if(!secp256k1_pubkey_load(context, &publicNonceTotalAffine, publicNonceTotal)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Get if signers negated their nonces since the public nonce total's y component isn't a quadratic residue
+	secp256k1_fe_normalize_var(&publicNonceTotalAffine.y);
+	const bool noncesNegated = !secp256k1_fe_is_quad_var(&publicNonceTotalAffine.y);
+	
+	// Check if allocating memory for the points and scalars failed
+	secp256k1_pubkey *points = malloc(sizeof(secp256k1_pubkey) * numberOfSignatures * 2);
+	secp256k1_scalar *scalars = malloc(sizeof(secp256k1_scalar) * numberOfSignatures * 2);
+	if(!points || !scalars) {
+	
+		// Free memory
+		free(points);
+		free(scalars);
+		
+		// Return false
+		return false;
+	}
+	
+	// Get challenge
+	secp256k1_scalar e;
+	secp256k1_scalar_set_b32(&e, challenge, NULL);
+	
+	// Go through all signatures
+	secp256k1_scalar generatorScalar;
+	secp256k1_scalar_set_int(&generatorScalar, 0);
+	for(size_t i = 0; i < numberOfSignatures; ++i) {
+	
+		// Check if signature's s component is invalid
+		int overflow;
+		secp256k1_scalar s;
+		secp256k1_scalar_set_b32(&s, &signatures[i * 64 + 32], &overflow);
+		if(overflow) {
+		
+			// Free memory
+			free(points);
+			free(scalars);
+			
+			// Return false
+			return false;
+		}
+		
+		// Check if signature's r component is invalid or loading the public nonce failed
+		secp256k1_fe r;
+		secp256k1_ge publicNonce;
+		if(!secp256k1_fe_set_b32(&r, &signatures[i * 64]) || !secp256k1_pubkey_load(context, &publicNonce, &publicNonces[i])) {
+		
+			// Free memory
+			free(points);
+			free(scalars);
+			
+			// Return false
+			return false;
+		}
+		
+		// Check if signature's r component isn't the public nonce's x component
+		secp256k1_fe_normalize_var(&publicNonce.x);
+		if(!secp256k1_fe_equal_var(&r, &publicNonce.x)) {
+		
+			// Free memory
+			free(points);
+			free(scalars);
+			
+			// Return false
+			return false;
+		}
+		
+		// Get random weight from the seed
+		secp256k1_scalar weight;
+		secp256k1_scalar unused;
+		secp256k1_scalar_chacha20(&weight, &unused, seed, i);
+		
+		// Add weight * s to the generator's scalar
+		secp256k1_scalar_mul(&s, &s, &weight);
+		secp256k1_scalar_add(&generatorScalar, &generatorScalar, &s);
+		
+		// Set public key's scalar to -weight * challenge
+		points[i] = publicKeys[i];
+		secp256k1_scalar_mul(&scalars[i], &weight, &e);
+		secp256k1_scalar_negate(&scalars[i], &scalars[i]);
+		
+		// Set public nonce's scalar to -weight or weight if signers negated their nonces
+		points[numberOfSignatures + i] = publicNonces[i];
+		if(noncesNegated) {
+		
+			// Set public nonce's scalar to weight
+			scalars[numberOfSignatures + i] = weight;
+		}
+		
+		// Otherwise
+		else {
+		
+			// Set public nonce's scalar to -weight
+			secp256k1_scalar_negate(&scalars[numberOfSignatures + i], &weight);
+		}
+	}
+	
+	// Check if performing multi-scalar multiplication of the weighted sum of s * G - challenge * public key - public nonce failed
+	const MultiScalarMultiplyData data = {context, points, scalars};
+	secp256k1_gej resultJacobian;
+	const bool result = secp256k1_ecmult_multi_var(&context->ecmult_ctx, scratchSpace, &resultJacobian, &generatorScalar, multiScalarMultiplyCallback, (void *)&data, numberOfSignatures * 2);
+	
+	// Free memory
+	free(points);
+	free(scalars);
+	
+	// Return if the weighted sum is infinity
+	return result && secp256k1_gej_is_infinity(&resultJacobian);
+}
+
+// Verify single-signer signatures
+bool verifySingleSignerSignatures(const secp256k1_context *context, secp256k1_scratch_space *scratchSpace, const uint8_t *signatures, const uint8_t *messages, const secp256k1_pubkey *publicKeys, size_t numberOfSignatures, const uint8_t *seed) {
+
+	// Check if no signatures were provided
+	if(!numberOfSignatures) {
+	
+		// Return true
+		return true;
+	}
+	
+	// Check if allocating memory for the points and scalars failed
+	secp256k1_pubkey *points = malloc(sizeof(secp256k1_pubkey) * numberOfSignatures * 2);
+	secp256k1_scalar *scalars = malloc(sizeof(secp256k1_scalar) * numberOfSignatures * 2);
+	if(!points || !scalars) {
+	
+		// Free memory
+		free(points);
+		free(scalars);
+		
+		// Return false
+		return false;
+	}
+	
+	// Go through all signatures
+	secp256k1_scalar generatorScalar;
+	secp256k1_scalar_set_int(&generatorScalar, 0);
+	for(size_t i = 0; i < numberOfSignatures; ++i) {
+	
+		// Check if signature's s component is invalid
+		int overflow;
+		secp256k1_scalar s;
+		secp256k1_scalar_set_b32(&s, &signatures[i * 64 + 32], &overflow);
+		if(overflow) {
+		
+			// Free memory
+			free(points);
+			free(scalars);
+			
+			// Return false
+			return false;
+		}
+		
+		// Check if signature's r component is invalid or it isn't the x component of a point with a quadratic residue y component like verifying the signature by itself requires
+		secp256k1_fe r;
+		secp256k1_ge publicNonce;
+		if(!secp256k1_fe_set_b32(&r, &signatures[i * 64]) || !secp256k1_ge_set_xquad(&publicNonce, &r)) {
+		
+			// Free memory
+			free(points);
+			free(scalars);
+			
+			// Return false
+			return false;
+		}
+		
+		// Get challenge from the public nonce, public key, and message
+		secp256k1_pubkey_save(&points[numberOfSignatures + i], &publicNonce);
+		secp256k1_scalar e;
+		secp256k1_compute_sighash_single(context, &e, &points[numberOfSignatures + i], &publicKeys[i], &messages[i * 32]);
+		
+		// Get random weight from the seed
+		secp256k1_scalar weight;
+		secp256k1_scalar unused;
+		secp256k1_scalar_chacha20(&weight, &unused, seed, i);
+		
+		// Add weight * s to the generator's scalar
+		secp256k1_scalar_mul(&s, &s, &weight);
+		secp256k1_scalar_add(&generatorScalar, &generatorScalar, &s);
+		
+		// Set public key's scalar to -weight * challenge
+		points[i] = publicKeys[i];
+		secp256k1_scalar_mul(&scalars[i], &weight, &e);
+		secp256k1_scalar_negate(&scalars[i], &scalars[i]);
+		
+		// Set public nonce's scalar to -weight
+		secp256k1_scalar_negate(&scalars[numberOfSignatures + i], &weight);
+	}
+	
+	// Check if performing multi-scalar multiplication of the weighted sum of s * G - challenge * public key - public nonce failed
+	const MultiScalarMultiplyData data = {context, points, scalars};
+	secp256k1_gej resultJacobian;
+	const bool result = secp256k1_ecmult_multi_var(&context->ecmult_ctx, scratchSpace, &resultJacobian, &generatorScalar, multiScalarMultiplyCallback, (void *)&data, numberOfSignatures * 2);
+	
+	// Free memory
+	free(points);
+	free(scalars);
+	
+	// Return if the weighted sum is infinity
+	return result && secp256k1_gej_is_infinity(&resultJacobian);
+}
+
+// Multi-scalar multiply
+bool multiScalarMultiply(const secp256k1_context *context, secp256k1_scratch_space *scratchSpace, secp256k1_pubkey *result, bool *isInfinity, const secp256k1_pubkey *points, const uint8_t *scalars, size_t numberOfPoints) {
+
+	// Check if no points were provided
+	if(!numberOfPoints) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if allocating memory for the parsed scalars failed
+	secp256k1_scalar *parsedScalars = malloc(sizeof(secp256k1_scalar) * numberOfPoints);
+	if(!parsedScalars) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Go through all scalars
+	for(size_t i = 0; i < numberOfPoints; ++i) {
+	
+		// Check if parsing scalar failed
+		int overflow;
+		secp256k1_scalar_set_b32(&parsedScalars[i], &scalars[i * 32], &overflow);
+		if(overflow) {
+		
+			// Clear parsed scalars
+			memset(parsedScalars, 0, sizeof(secp256k1_scalar) * numberOfPoints);
+			
+			// Free memory
+			free(parsedScalars);
+			
+			// Return false
+			return false;
+		}
+	}
+	
+	// Check if performing multi-scalar multiplication failed
+	// The library uses Strauss's algorithm for small inputs and Pippenger's algorithm for large inputs
+	const MultiScalarMultiplyData data = {context, points, parsedScalars};
+	secp256k1_gej resultJacobian;
+	if(!secp256k1_ecmult_multi_var(&context->ecmult_ctx, scratchSpace, &resultJacobian, NULL, multiScalarMultiplyCallback, (void *)&data, numberOfPoints)) {
+	
+		// Clear parsed scalars
+		memset(parsedScalars, 0, sizeof(secp256k1_scalar) * numberOfPoints);
+		
+		// Free memory
+		free(parsedScalars);
+		
+		// Return false
+		return false;
+	}
+	
+	// Clear parsed scalars
+	memset(parsedScalars, 0, sizeof(secp256k1_scalar) * numberOfPoints);
+	
+	// Free memory
+	free(parsedScalars);
+	
+	// Check if the result is infinity
+	*isInfinity = secp256k1_gej_is_infinity(&resultJacobian);
+	if(*isInfinity) {
+	
+		// Return true since infinity is a valid result that can't be saved as a public key
+		return true;
+	}
+	
+	// Save result
+	secp256k1_ge resultAffine;
+	secp256k1_ge_set_gej(&resultAffine, &resultJacobian);
+	secp256k1_pubkey_save(result, &resultAffine);
+	
+	// Return true
+	return true;
+}
+
+// Context memory usage
+size_t contextMemoryUsage(const secp256k1_context *context) {
+
+	// Get size of the context
+	size_t size = sizeof(*context);
+	
+	// Check if context's verify tables are built
+	if(secp256k1_ecmult_context_is_built(&context->ecmult_ctx)) {
+	
+		// Add size of the verify tables
+		size += sizeof((*context->ecmult_ctx.pre_g)[0]) * ECMULT_TABLE_SIZE(WINDOW_G);
+		
+		// Check if using endomorphism
+		#ifdef USE_ENDOMORPHISM
+		
+			// Add size of the endomorphism verify tables
+			size += sizeof((*context->ecmult_ctx.pre_g_128)[0]) * ECMULT_TABLE_SIZE(WINDOW_G);
+		#endif
+	}
+	
+	// Check if not using static precomputation
+	#ifndef USE_ECMULT_STATIC_PRECOMPUTATION
+	
+		// Check if context's sign tables are built
+		if(secp256k1_ecmult_gen_context_is_built(&context->ecmult_gen_ctx)) {
+		
+			// Add size of the sign tables
+			size += sizeof(*context->ecmult_gen_ctx.prec);
+		}
+	#endif
+	
+	// Return size
+	return size;
+}
+
+// Scratch space memory usage
+size_t scratchSpaceMemoryUsage(const secp256k1_scratch_space *scratchSpace) {
+
+	// Get size of the scratch space
+	size_t size = sizeof(*scratchSpace);
+	
+	// Go through all of the scratch space's allocated frames
+	for(size_t i = 0; i < scratchSpace->frame; ++i) {
+	
+		// Add size of the frame
+		size += scratchSpace->frame_size[i];
+	}
+	
+	// Return size
+	return size;
+}
+
+// Generators memory usage
+size_t generatorsMemoryUsage(const secp256k1_bulletproof_generators *generators) {
+
+	// Check if bulletproof module is enabled
+	#ifdef ENABLE_MODULE_BULLETPROOF
+	
+		// Return size of the generators and their points which includes the blinding generator
+		return sizeof(*generators) + sizeof(*generators->gens) * (generators->n + 1);
+		
+	// Otherwise
+	#else
+	
+		// Return zero
+		return 0;
+	#endif
+}
+
+// Verification cache key
+void verificationCacheKey(uint8_t *key, const uint8_t *salt, const uint8_t *const *items, const size_t *itemSizes, size_t numberOfItems) {
+
+	// Hash the salt
+	secp256k1_sha256 sha256;
+	secp256k1_sha256_initialize(&sha256);
+	secp256k1_sha256_write(&sha256, salt, VERIFICATION_CACHE_SALT_SIZE);
+	
+	// Go through all items
+	for(size_t i = 0; i < numberOfItems; ++i) {
+	
+		// Hash the item's size in big endian so that items can't be shifted into each other
+		uint8_t itemSize[sizeof(uint64_t)];
+		for(size_t j = 0; j < sizeof(itemSize); ++j) {
+		
+			// Set byte to the size's byte
+			itemSize[j] = (uint64_t)itemSizes[i] >> ((sizeof(itemSize) - j - 1) * 8);
+		}
+		secp256k1_sha256_write(&sha256, itemSize, sizeof(itemSize));
+		
+		// Check if item isn't empty
+		if(itemSizes[i]) {
+		
+			// Hash the item
+			secp256k1_sha256_write(&sha256, items[i], itemSizes[i]);
+		}
+	}
+	
+	// Set key to the hash
+	secp256k1_sha256_finalize(&sha256, key);
+}
+
+// Bulletproof rewind cache initialize
+void bulletproofRewindCacheInitialize(BulletproofRewindCache *cache, const uint8_t *nonce) {
+
+	// Get alpha and rho from the nonce
+	secp256k1_scalar_chacha20(&cache->alpha, &cache->rho, nonce, 0);
+	
+	// Get tau one and tau two from the nonce
+	secp256k1_scalar_chacha20(&cache->tau1, &cache->tau2, nonce, 1);
+	
+	// Get value generator's x component and parity
+	secp256k1_ge valueGenerator;
+	secp256k1_generator_load(&valueGenerator, &secp256k1_generator_const_h);
+	secp256k1_fe_normalize_var(&valueGenerator.x);
+	secp256k1_fe_normalize_var(&valueGenerator.y);
+	secp256k1_fe_get_b32(cache->valueGeneratorX, &valueGenerator.x);
+	cache->valueGeneratorParity = !secp256k1_fe_is_quad_var(&valueGenerator.y);
+}
+
+// Bulletproof rewind cache clear
+void bulletproofRewindCacheClear(BulletproofRewindCache *cache) {
+
+	// Clear alpha and rho
+	secp256k1_scalar_clear(&cache->alpha);
+	secp256k1_scalar_clear(&cache->rho);
+	
+	// Clear tau one and tau two
+	secp256k1_scalar_clear(&cache->tau1);
+	secp256k1_scalar_clear(&cache->tau2);
+}
+
+// Bulletproof rewind precheck format
+bool bulletproofRewindPrecheckFormat(const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize) {
+
+	// Check if proof or commit have invalid sizes or the commit has an invalid prefix
+	if(proofSize < BULLETPROOF_MINIMUM_PROOF_SIZE || proofSize > SECP256K1_BULLETPROOF_MAX_PROOF || commitSize != COMMIT_SIZE || (commit[0] & 0xFE) != 8) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if proof's tau x is invalid
+	int overflow;
+	secp256k1_scalar tauX;
+	secp256k1_scalar_set_b32(&tauX, &proof[0], &overflow);
+	if(overflow || secp256k1_scalar_is_zero(&tauX)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if proof's mu is invalid
+	secp256k1_scalar mu;
+	secp256k1_scalar_set_b32(&mu, &proof[32], &overflow);
+	if(overflow || secp256k1_scalar_is_zero(&mu)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Return true
+	return true;
+}
+
+// Bulletproof rewind precheck finish
+bool bulletproofRewindPrecheckFinish(const BulletproofRewindCache *cache, const uint8_t *proof, const uint8_t *challenge) {
+
+	// Check if x challenge is invalid
+	int overflow;
+	secp256k1_scalar x;
+	secp256k1_scalar_set_b32(&x, challenge, &overflow);
+	if(overflow || secp256k1_scalar_is_zero(&x)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Recover the encoded value and message by adding the cached alpha and rho * x to the proof's negated mu
+	secp256k1_scalar mu;
+	secp256k1_scalar_set_b32(&mu, &proof[32], NULL);
+	secp256k1_scalar rhoX;
+	secp256k1_scalar_mul(&rhoX, &cache->rho, &x);
+	secp256k1_scalar_add(&mu, &mu, &rhoX);
+	secp256k1_scalar_add(&mu, &mu, &cache->alpha);
+	uint8_t encoded[32];
+	secp256k1_scalar_get_b32(encoded, &mu);
+	
+	// Check if encoded value and message isn't padded correctly
+	static const uint8_t padding[BULLETPROOF_ENCODED_PADDING_SIZE] = {0};
+	const bool result = !memcmp(encoded, padding, sizeof(padding));
+	
+	// Clear secrets
+	secp256k1_scalar_clear(&rhoX);
+	secp256k1_scalar_clear(&mu);
+	memset(encoded, 0, sizeof(encoded));
+	
+	// Return result
+	return result;
+}
+
+// Bulletproof rewind challenge message
+void bulletproofRewindChallengeMessage(uint8_t *message, const uint8_t *challenge, uint8_t parity, const uint8_t *first, const uint8_t *second) {
+
+	// Set message to the challenge, parity, and components
+	memcpy(message, challenge, 32);
+	message[32] = parity;
+	memcpy(&message[32 + 1], first, 32);
+	memcpy(&message[32 + 1 + 32], second, 32);
+}
+
+// SHA-256 multiple
+void sha256Multiple(uint8_t *hashes, const uint8_t *messages, size_t messageSize, size_t numberOfMessages) {
+
+	// Go through all groups of messages
+	for(size_t start = 0; start < numberOfMessages; start += SHA256_LANES) {
+	
+		// Get number of messages in the group
+		const size_t numberOfLanes = (numberOfMessages - start < SHA256_LANES) ? numberOfMessages - start : SHA256_LANES;
+		
+		// Check if AVX2 is supported
+		#ifdef AVX2_SUPPORTED
+		
+			// Check if the group has multiple messages and the CPU supports AVX2
+			if(numberOfLanes > 1 && __builtin_cpu_supports("avx2")) {
+			
+				// Go through all lanes
+				const uint8_t *laneMessages[SHA256_LANES];
+				for(size_t i = 0; i < SHA256_LANES; ++i) {
+				
+					// Set lane's message to its message or the group's first message if the lane is unused
+					laneMessages[i] = &messages[(start + ((i < numberOfLanes) ? i : 0)) * messageSize];
+				}
+				
+				// Hash all lanes' messages together
+				uint8_t laneHashes[SHA256_LANES][32];
+				sha256MultipleAvx2(laneHashes, laneMessages, messageSize);
+				
+				// Copy used lanes' hashes to the hashes
+				memcpy(&hashes[start * 32], laneHashes, numberOfLanes * 32);
+				
+				// Continue
+				continue;
+			}
+		#endif
+		
+		// Go through all messages in the group
+		for(size_t i = start; i < start + numberOfLanes; ++i) {
+		
+			// Hash message
+			secp256k1_sha256 sha256;
+			secp256k1_sha256_initialize(&sha256);
+			secp256k1_sha256_write(&sha256, &messages[i * messageSize], messageSize);
+			secp256k1_sha256_finalize(&sha256, &hashes[i * 32]);
+		}
+	}
+}
+
+// Check if AVX2 is supported
+#ifdef AVX2_SUPPORTED
+
+	// SHA-256 AVX2 rotate right
+	__attribute__((target("avx2"))) __m256i sha256Avx2RotateRight(__m256i value, int bits) {
+	
+		// Return value rotated right by the bits
+		return _mm256_or_si256(_mm256_srli_epi32(value, bits), _mm256_slli_epi32(value, 32 - bits));
+	}
+	
+	// SHA-256 multiple AVX2
+	__attribute__((target("avx2"))) void sha256MultipleAvx2(uint8_t (*hashes)[32], const uint8_t *const *messages, size_t messageSize) {
+	
+		// Initialize state with each lane in a different 32-bit element
+		__m256i state[8];
+		for(size_t i = 0; i < 8; ++i) {
+		
+			// Set state word to the initial value in all lanes
+			state[i] = _mm256_set1_epi32(SHA256_INITIAL_STATE[i]);
+		}
+		
+		// Go through all padded blocks
+		const size_t numberOfBlocks = (messageSize + 1 + sizeof(uint64_t) + 63) / 64;
+		for(size_t block = 0; block < numberOfBlocks; ++block) {
+		
+			// Get the block's offset and the number of message bytes in it
+			const size_t offset = block * 64;
+			const size_t numberOfMessageBytes = (messageSize <= offset) ? 0 : ((messageSize - offset < 64) ? messageSize - offset : 64);
+			
+			// Go through all lanes
+			uint8_t laneBlocks[SHA256_LANES][64];
+			for(size_t i = 0; i < SHA256_LANES; ++i) {
+			
+				// Copy lane's message bytes to the lane's block and pad the rest with zeros
+				memcpy(laneBlocks[i], &messages[i][offset], numberOfMessageBytes);
+				memset(&laneBlocks[i][numberOfMessageBytes], 0, 64 - numberOfMessageBytes);
+				
+				// Check if the message ends in the block
+				if(messageSize >= offset && messageSize < offset + 64) {
+				
+					// Append the end of message marker
+					laneBlocks[i][messageSize - offset] = 0x80;
+				}
+				
+				// Check if block is the last block
+				if(block == numberOfBlocks - 1) {
+				
+					// Append the message's length in bits in big endian
+					for(size_t j = 0; j < sizeof(uint64_t); ++j) {
+					
+						// Set byte to the length's byte
+						laneBlocks[i][64 - sizeof(uint64_t) + j] = ((uint64_t)messageSize * 8) >> ((sizeof(uint64_t) - j - 1) * 8);
+					}
+				}
+			}
+			
+			// Go through all of the block's words
+			__m256i schedule[64];
+			for(size_t i = 0; i < 16; ++i) {
+			
+				// Get word from each lane's block in big endian
+				uint32_t words[SHA256_LANES];
+				for(size_t j = 0; j < SHA256_LANES; ++j) {
+				
+					// Get lane's word
+					words[j] = ((uint32_t)laneBlocks[j][i * 4] << 24) | ((uint32_t)laneBlocks[j][i * 4 + 1] << 16) | ((uint32_t)laneBlocks[j][i * 4 + 2] << 8) | laneBlocks[j][i * 4 + 3];
+				}
+				schedule[i] = _mm256_loadu_si256((const __m256i *)words);
+			}
+			
+			// Go through the rest of the message schedule
+			for(size_t i = 16; i < 64; ++i) {
+			
+				// Expand message schedule
+				const __m256i sigma0 = _mm256_xor_si256(_mm256_xor_si256(sha256Avx2RotateRight(schedule[i - 15], 7), sha256Avx2RotateRight(schedule[i - 15], 18)), _mm256_srli_epi32(schedule[i - 15], 3));
+				const __m256i sigma1 = _mm256_xor_si256(_mm256_xor_si256(sha256Avx2RotateRight(schedule[i - 2], 17), sha256Avx2RotateRight(schedule[i - 2], 19)), _mm256_srli_epi32(schedule[i - 2], 10));
+				schedule[i] = _mm256_add_epi32(_mm256_add_epi32(schedule[i - 16], sigma0), _mm256_add_epi32(schedule[i - 7], sigma1));
+			}
+			
+			// Go through all rounds
+			__m256i a = state[0], b = state[1], c = state[2], d = state[3], e = state[4], f = state[5], g = state[6], h = state[7];
+			for(size_t i = 0; i < 64; ++i) {
+			
+				// Perform round
+				const __m256i sum1 = _mm256_xor_si256(_mm256_xor_si256(sha256Avx2RotateRight(e, 6), sha256Avx2RotateRight(e, 11)), sha256Avx2RotateRight(e, 25));
+				const __m256i choose = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+				const __m256i temp1 = _mm256_add_epi32(_mm256_add_epi32(_mm256_add_epi32(h, sum1), _mm256_add_epi32(choose, _mm256_set1_epi32(SHA256_ROUND_CONSTANTS[i]))), schedule[i]);
+				const __m256i sum0 = _mm256_xor_si256(_mm256_xor_si256(sha256Avx2RotateRight(a, 2), sha256Avx2RotateRight(a, 13)), sha256Avx2RotateRight(a, 22));
+				const __m256i majority = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+				const __m256i temp2 = _mm256_add_epi32(sum0, majority);
+				h = g;
+				g = f;
+				f = e;
+				e = _mm256_add_epi32(d, temp1);
+				d = c;
+				c = b;
+				b = a;
+				a = _mm256_add_epi32(temp1, temp2);
+			}
+			
+			// Add the compressed block to the state
+			state[0] = _mm256_add_epi32(state[0], a);
+			state[1] = _mm256_add_epi32(state[1], b);
+			state[2] = _mm256_add_epi32(state[2], c);
+			state[3] = _mm256_add_epi32(state[3], d);
+			state[4] = _mm256_add_epi32(state[4], e);
+			state[5] = _mm256_add_epi32(state[5], f);
+			state[6] = _mm256_add_epi32(state[6], g);
+			state[7] = _mm256_add_epi32(state[7], h);
+		}
+		
+		// Go through all state words
+		for(size_t i = 0; i < 8; ++i) {
+		
+			// Get state word from each lane
+			uint32_t words[SHA256_LANES];
+			_mm256_storeu_si256((__m256i *)words, state[i]);
+			
+			// Go through all lanes
+			for(size_t j = 0; j < SHA256_LANES; ++j) {
+			
+				// Set lane's hash word in big endian
+				hashes[j][i * 4] = words[j] >> 24;
+				hashes[j][i * 4 + 1] = words[j] >> 16;
+				hashes[j][i * 4 + 2] = words[j] >> 8;
+				hashes[j][i * 4 + 3] = words[j];
+			}
+		}
+	}
+#endif
+
+// Are quadratic residues
+void areQuadraticResidues(const secp256k1_fe *values, size_t numberOfValues, bool *results) {
+
+	// Check if field AVX2 is supported
+	#ifdef FIELD_AVX2_SUPPORTED
+	
+		// Check if there's multiple values and field AVX2 is usable
+		if(numberOfValues > 1 && fieldAvx2Usable()) {
+		
+			// Go through all lanes
+			secp256k1_fe laneValues[FIELD_LANES];
+			for(size_t i = 0; i < FIELD_LANES; ++i) {
+			
+				// Set lane's value to its value or the first value if the lane is unused
+				laneValues[i] = values[(i < numberOfValues) ? i : 0];
+			}
+			
+			// Check all lanes' values together
+			bool laneResults[FIELD_LANES];
+			fieldAvx2AreQuadraticResidues(laneValues, laneResults);
+			
+			// Copy used lanes' results to the results
+			memcpy(results, laneResults, numberOfValues * sizeof(bool));
+			
+			// Return
+			return;
+		}
+	#endif
+	
+	// Go through all values
+	for(size_t i = 0; i < numberOfValues; ++i) {
+	
+		// Set value's result to if it's a quadratic residue
+		results[i] = secp256k1_fe_is_quad_var(&values[i]);
+	}
+}
+
+// Check if field AVX2 is supported
+#ifdef FIELD_AVX2_SUPPORTED
+
+	// Field AVX2 usable
+	bool fieldAvx2Usable(void) {
+	
+		// Check if field AVX2 state isn't known
+		int state = __atomic_load_n(&fieldAvx2State, __ATOMIC_ACQUIRE);
+		if(state == FIELD_AVX2_STATE_UNKNOWN) {
+		
+			// Set state to usable if the CPU supports AVX2 and the results match the scalar field's results
+			state = (__builtin_cpu_supports("avx2") && fieldAvx2SelfTest()) ? FIELD_AVX2_STATE_USABLE : FIELD_AVX2_STATE_UNUSABLE;
+			__atomic_store_n(&fieldAvx2State, state, __ATOMIC_RELEASE);
+		}
+		
+		// Return if field AVX2 is usable
+		return state == FIELD_AVX2_STATE_USABLE;
+	}
+	
+	// Field AVX2 self-test
+	__attribute__((target("avx2"))) bool fieldAvx2SelfTest(void) {
+	
+		// Go through all self-test values
+		secp256k1_fe values[FIELD_LANES];
+		secp256k1_fe reversedValues[FIELD_LANES];
+		for(size_t i = 0; i < FIELD_LANES; ++i) {
+		
+			// Get self-test value
+			secp256k1_fe_set_b32(&values[i], FIELD_AVX2_SELF_TEST_VALUES[i]);
+			reversedValues[FIELD_LANES - i - 1] = values[i];
+		}
+		
+		// Get products, squares, and if they are quadratic residues with the vectorized field
+		FieldAvx2 first;
+		FieldAvx2 second;
+		FieldAvx2 product;
+		FieldAvx2 square;
+		fieldAvx2Load(&first, values);
+		fieldAvx2Load(&second, reversedValues);
+		fieldAvx2Multiply(&product, &first, &second);
+		fieldAvx2Square(&square, &first);
+		secp256k1_fe products[FIELD_LANES];
+		secp256k1_fe squares[FIELD_LANES];
+		bool residues[FIELD_LANES];
+		fieldAvx2Store(products, &product);
+		fieldAvx2Store(squares, &square);
+		fieldAvx2AreQuadraticResidues(values, residues);
+		
+		// Go through all self-test values
+		for(size_t i = 0; i < FIELD_LANES; ++i) {
+		
+			// Check if the vectorized field's results don't match the scalar field's results
+			secp256k1_fe expectedProduct;
+			secp256k1_fe expectedSquare;
+			secp256k1_fe_mul(&expectedProduct, &values[i], &reversedValues[i]);
+			secp256k1_fe_sqr(&expectedSquare, &values[i]);
+			secp256k1_fe_normalize_var(&expectedProduct);
+			secp256k1_fe_normalize_var(&expectedSquare);
+			if(!secp256k1_fe_equal_var(&expectedProduct, &products[i]) || !secp256k1_fe_equal_var(&expectedSquare, &squares[i]) || residues[i] != secp256k1_fe_is_quad_var(&values[i])) {
+			
+				// Return false
+				return false;
+			}
+		}
+		
+		// Return true
+		return true;
+	}
+	
+	// Field AVX2 load
+	__attribute__((target("avx2"))) void fieldAvx2Load(FieldAvx2 *result, const secp256k1_fe *values) {
+	
+		// Go through all limbs
+		for(size_t i = 0; i < FIELD_LIMBS; ++i) {
+		
+			// Set result's limb to the values' limbs
+			result->n[i] = _mm256_set_epi64x(values[3].n[i], values[2].n[i], values[1].n[i], values[0].n[i]);
+		}
+	}
+	
+	// Field AVX2 store
+	__attribute__((target("avx2"))) void fieldAvx2Store(secp256k1_fe *results, const FieldAvx2 *value) {
+	
+		// Go through all limbs
+		for(size_t i = 0; i < FIELD_LIMBS; ++i) {
+		
+			// Go through all lanes
+			uint64_t limbs[FIELD_LANES];
+			_mm256_storeu_si256((__m256i *)limbs, value->n[i]);
+			for(size_t j = 0; j < FIELD_LANES; ++j) {
+			
+				// Set lane's result's limb
+				results[j].n[i] = limbs[j];
+			}
+		}
+		
+		// Check if verifying
+		#ifdef VERIFY
+		
+			// Go through all lanes
+			for(size_t i = 0; i < FIELD_LANES; ++i) {
+			
+				// Set lane's result's magnitude and normalized since its top limb can be slightly larger than normalized
+				results[i].magnitude = 2;
+				results[i].normalized = 0;
+			}
+		#endif
+	}
+	
+	// Field AVX2 reduce
+	__attribute__((target("avx2"))) void fieldAvx2Reduce(FieldAvx2 *result, __m256i *product) {
+	
+		// Go through all of the product's limbs
+		const __m256i limbMask = _mm256_set1_epi64x(FIELD_LIMB_MASK);
+		for(size_t i = 0; i < 2 * FIELD_LIMBS - 1; ++i) {
+		
+			// Carry the limb's overflow into the next limb
+			product[i + 1] = _mm256_add_epi64(product[i + 1], _mm256_srli_epi64(product[i], FIELD_LIMB_BITS));
+			product[i] = _mm256_and_si256(product[i], limbMask);
+		}
+		
+		// Go through all of the product's high limbs
+		const __m256i reductionLow = _mm256_set1_epi64x(FIELD_REDUCTION_LOW);
+		const __m256i reductionHigh = _mm256_set1_epi64x(FIELD_REDUCTION_HIGH);
+		__m256i reduced[FIELD_LIMBS + 1];
+		reduced[FIELD_LIMBS] = _mm256_setzero_si256();
+		for(size_t i = 0; i < FIELD_LIMBS; ++i) {
+		
+			// Fold high limb into the low limbs since 2^260 is congruent to 2^36 + 0x3D10
+			reduced[i] = _mm256_add_epi64(product[i], _mm256_mul_epu32(product[i + FIELD_LIMBS], reductionLow));
+		}
+		for(size_t i = 0; i < FIELD_LIMBS; ++i) {
+		
+			// Fold high limb's 2^36 part into the next low limb
+			reduced[i + 1] = _mm256_add_epi64(reduced[i + 1], _mm256_mul_epu32(product[i + FIELD_LIMBS], reductionHigh));
+		}
+		
+		// Go through all reduced limbs
+		for(size_t i = 0; i < FIELD_LIMBS; ++i) {
+		
+			// Carry the limb's overflow into the next limb
+			reduced[i + 1] = _mm256_add_epi64(reduced[i + 1], _mm256_srli_epi64(reduced[i], FIELD_LIMB_BITS));
+			reduced[i] = _mm256_and_si256(reduced[i], limbMask);
+		}
+		
+		// Fold the remaining high limb into the low limbs
+		reduced[0] = _mm256_add_epi64(reduced[0], _mm256_mul_epu32(reduced[FIELD_LIMBS], reductionLow));
+		reduced[1] = _mm256_add_epi64(reduced[1], _mm256_mul_epu32(reduced[FIELD_LIMBS], reductionHigh));
+		
+		// Go through all reduced limbs except the top limb
+		for(size_t i = 0; i < FIELD_LIMBS - 1; ++i) {
+		
+			// Carry the limb's overflow into the next limb
+			reduced[i + 1] = _mm256_add_epi64(reduced[i + 1], _mm256_srli_epi64(reduced[i], FIELD_LIMB_BITS));
+			reduced[i] = _mm256_and_si256(reduced[i], limbMask);
+		}
+		
+		// Fold everything above 2^256 into the low limbs since 2^256 is congruent to 0x1000003D1
+		const __m256i overflow = _mm256_srli_epi64(reduced[FIELD_LIMBS - 1], FIELD_TOP_LIMB_BITS);
+		reduced[FIELD_LIMBS - 1] = _mm256_and_si256(reduced[FIELD_LIMBS - 1], _mm256_set1_epi64x(FIELD_TOP_LIMB_MASK));
+		reduced[0] = _mm256_add_epi64(reduced[0], _mm256_mul_epu32(overflow, _mm256_set1_epi64x(FIELD_OVERFLOW_LOW)));
+		reduced[1] = _mm256_add_epi64(reduced[1], _mm256_slli_epi64(overflow, FIELD_OVERFLOW_HIGH_BITS));
+		
+		// Go through all reduced limbs except the top limb
+		for(size_t i = 0; i < FIELD_LIMBS - 1; ++i) {
+		
+			// Carry the limb's overflow into the next limb
+			reduced[i + 1] = _mm256_add_epi64(reduced[i + 1], _mm256_srli_epi64(reduced[i], FIELD_LIMB_BITS));
+			reduced[i] = _mm256_and_si256(reduced[i], limbMask);
+		}
+		
+		// Set result to the reduced limbs
+		memcpy(result->n, reduced, sizeof(result->n));
+	}
+	
+	// Field AVX2 multiply
+	__attribute__((target("avx2"))) void fieldAvx2Multiply(FieldAvx2 *result, const FieldAvx2 *first, const FieldAvx2 *second) {
+	
+		// Go through all limbs of the first and second values
+		__m256i product[2 * FIELD_LIMBS];
+		for(size_t i = 0; i < 2 * FIELD_LIMBS; ++i) {
+		
+			// Clear product's limb
+			product[i] = _mm256_setzero_si256();
+		}
+		for(size_t i = 0; i < FIELD_LIMBS; ++i) {
+			for(size_t j = 0; j < FIELD_LIMBS; ++j) {
+			
+				// Add the limbs' product to the product
+				product[i + j] = _mm256_add_epi64(product[i + j], _mm256_mul_epu32(first->n[i], second->n[j]));
+			}
+		}
+		
+		// Reduce product into the result
+		fieldAvx2Reduce(result, product);
+	}
+	
+	// Field AVX2 square
+	__attribute__((target("avx2"))) void fieldAvx2Square(FieldAvx2 *result, const FieldAvx2 *value) {
+	
+		// Go through all limbs of the value
+		__m256i product[2 * FIELD_LIMBS];
+		for(size_t i = 0; i < 2 * FIELD_LIMBS; ++i) {
+		
+			// Clear product's limb
+			product[i] = _mm256_setzero_si256();
+		}
+		for(size_t i = 0; i < FIELD_LIMBS; ++i) {
+		
+			// Add the limb's square to the product
+			product[2 * i] = _mm256_add_epi64(product[2 * i], _mm256_mul_epu32(value->n[i], value->n[i]));
+			
+			// Go through all following limbs
+			const __m256i doubled = _mm256_add_epi64(value->n[i], value->n[i]);
+			for(size_t j = i + 1; j < FIELD_LIMBS; ++j) {
+			
+				// Add the limbs' product twice to the product since it appears twice in the square
+				product[i + j] = _mm256_add_epi64(product[i + j], _mm256_mul_epu32(doubled, value->n[j]));
+			}
+		}
+		
+		// Reduce product into the result
+		fieldAvx2Reduce(result, product);
+	}
+	
+	// Field AVX2 square multiple
+	__attribute__((target("avx2"))) void fieldAvx2SquareMultiple(FieldAvx2 *result, const FieldAvx2 *value, int numberOfSquares) {
+	
+		// Square value the number of times
+		*result = *value;
+		for(int i = 0; i < numberOfSquares; ++i) {
+		
+			// Square result
+			fieldAvx2Square(result, result);
+		}
+	}
+	
+	// Field AVX2 are quadratic residues
+	__attribute__((target("avx2"))) void fieldAvx2AreQuadraticResidues(const secp256k1_fe *values, bool *results) {
+	
+		// Go through all lanes
+		secp256k1_fe normalizedValues[FIELD_LANES];
+		for(size_t i = 0; i < FIELD_LANES; ++i) {
+		
+			// Get lane's normalized value which keeps the limbs small enough for the vectorized field
+			normalizedValues[i] = values[i];
+			secp256k1_fe_normalize_var(&normalizedValues[i]);
+		}
+		
+		// Compute the square root candidate value^((p + 1) / 4) with the same addition chain as the scalar field
+		FieldAvx2 value;
+		fieldAvx2Load(&value, normalizedValues);
+		FieldAvx2 x2;
+		fieldAvx2Square(&x2, &value);
+		fieldAvx2Multiply(&x2, &x2, &value);
+		FieldAvx2 x3;
+		fieldAvx2Square(&x3, &x2);
+		fieldAvx2Multiply(&x3, &x3, &value);
+		FieldAvx2 x6;
+		fieldAvx2SquareMultiple(&x6, &x3, 3);
+		fieldAvx2Multiply(&x6, &x6, &x3);
+		FieldAvx2 x9;
+		fieldAvx2SquareMultiple(&x9, &x6, 3);
+		fieldAvx2Multiply(&x9, &x9, &x3);
+		FieldAvx2 x11;
+		fieldAvx2SquareMultiple(&x11, &x9, 2);
+		fieldAvx2Multiply(&x11, &x11, &x2);
+		FieldAvx2 x22;
+		fieldAvx2SquareMultiple(&x22, &x11, 11);
+		fieldAvx2Multiply(&x22, &x22, &x11);
+		FieldAvx2 x44;
+		fieldAvx2SquareMultiple(&x44, &x22, 22);
+		fieldAvx2Multiply(&x44, &x44, &x22);
+		FieldAvx2 x88;
+		fieldAvx2SquareMultiple(&x88, &x44, 44);
+		fieldAvx2Multiply(&x88, &x88, &x44);
+		FieldAvx2 x176;
+		fieldAvx2SquareMultiple(&x176, &x88, 88);
+		fieldAvx2Multiply(&x176, &x176, &x88);
+		FieldAvx2 x220;
+		fieldAvx2SquareMultiple(&x220, &x176, 44);
+		fieldAvx2Multiply(&x220, &x220, &x44);
+		FieldAvx2 x223;
+		fieldAvx2SquareMultiple(&x223, &x220, 3);
+		fieldAvx2Multiply(&x223, &x223, &x3);
+		FieldAvx2 root;
+		fieldAvx2SquareMultiple(&root, &x223, 23);
+		fieldAvx2Multiply(&root, &root, &x22);
+		fieldAvx2SquareMultiple(&root, &root, 6);
+		fieldAvx2Multiply(&root, &root, &x2);
+		fieldAvx2SquareMultiple(&root, &root, 2);
+		
+		// Get the square of the square root candidate
+		FieldAvx2 square;
+		fieldAvx2Square(&square, &root);
+		secp256k1_fe squares[FIELD_LANES];
+		fieldAvx2Store(squares, &square);
+		
+		// Go through all lanes
+		for(size_t i = 0; i < FIELD_LANES; ++i) {
+		
+			// Set lane's result to if the square root candidate is a square root of the value
+			results[i] = secp256k1_fe_equal_var(&normalizedValues[i], &squares[i]);
+		}
+	}
+#endif
+
+// Multi-scalar multiply callback
+int multiScalarMultiplyCallback(secp256k1_scalar *scalar, secp256k1_ge *point, size_t index, void *data) {
+
+	// Get multi-scalar multiply data
+	const MultiScalarMultiplyData *multiScalarMultiplyData = (const MultiScalarMultiplyData *)data;
+	
+	// Set scalar
+	*scalar = multiScalarMultiplyData->scalars[index];
+	
+	// Return if loading point was successful
+	return secp256k1_pubkey_load(multiScalarMultiplyData->context, point, &multiScalarMultiplyData->points[index]);
+}
+
+
+// Check if bulletproof module isn't enabled
+#ifndef ENABLE_MODULE_BULLETPROOF
+
+	// Bulletproof generators create
+	secp256k1_bulletproof_generators *secp256k1_bulletproof_generators_create(const secp256k1_context *ctx, const secp256k1_generator *blinding_gen, size_t n) {
+	
+		// Return nothing
+		return NULL;
+	}
+	
+	// Bulletproof generators destroy
+	void secp256k1_bulletproof_generators_destroy(const secp256k1_context *ctx, secp256k1_bulletproof_generators *gen) {
+	
+	}
+	
+	// Bulletproof rangeproof verify
+	int secp256k1_bulletproof_rangeproof_verify(const secp256k1_context *ctx, secp256k1_scratch_space *scratch, const secp256k1_bulletproof_generators *gens, const unsigned char *proof, size_t plen, const uint64_t *min_value, const secp256k1_pedersen_commitment *commit, size_t n_commits, size_t nbits, const secp256k1_generator *value_gen, const unsigned char *extra_commit, size_t extra_commit_len) {
+	
+		// Return failure
+		return 0;
+	}
+	
+	// Bulletproof rangeproof verify multi
+	int secp256k1_bulletproof_rangeproof_verify_multi(const secp256k1_context *ctx, secp256k1_scratch_space *scratch, const secp256k1_bulletproof_generators *gens, const unsigned char *const *proof, size_t n_proofs, size_t plen, const uint64_t *const *min_value, const secp256k1_pedersen_commitment *const *commit, size_t n_commits, size_t nbits, const secp256k1_generator *value_gen, const unsigned char *const *extra_commit, size_t *extra_commit_len) {
+	
+		// Return failure
+		return 0;
+	}
+	
+	// Bulletproof rangeproof rewind
+	int secp256k1_bulletproof_rangeproof_rewind(const secp256k1_context *ctx, uint64_t *value, unsigned char *blind, const unsigned char *proof, size_t plen, uint64_t min_value, const secp256k1_pedersen_commitment *commit, const secp256k1_generator *value_gen, const unsigned char *nonce, const unsigned char *extra_commit, size_t extra_commit_len, unsigned char *message) {
+	
+		// Return failure
+		return 0;
+	}
+	
+	// Bulletproof rangeproof prove
+	int secp256k1_bulletproof_rangeproof_prove(const secp256k1_context *ctx, secp256k1_scratch_space *scratch, const secp256k1_bulletproof_generators *gens, unsigned char *proof, size_t *plen, unsigned char *tau_x, secp256k1_pubkey *t_one, secp256k1_pubkey *t_two, const uint64_t *value, const uint64_t *min_value, const unsigned char *const *blind, const secp256k1_pedersen_commitment *const *commits, size_t n_commits, const secp256k1_generator *value_gen, size_t nbits, const unsigned char *nonce, const unsigned char *private_nonce, const unsigned char *extra_commit, size_t extra_commit_len, const unsigned char *message) {
+	
+		// Return failure
+		return 0;
+	}
+#endif
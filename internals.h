@@ -0,0 +1,77 @@
+// Header guard
+#ifndef INTERNALS_H
+#define INTERNALS_H
+
+
+// Header files
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "secp256k1.h"
+#include "secp256k1_bulletproofs.h"
+
+
+// Structures
+
+// Bulletproof rewind cache
+typedef struct BulletproofRewindCache BulletproofRewindCache;
+
+
+// Function prototypes
+
+// Bulletproof rewind precheck
+bool bulletproofRewindPrecheck(const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize, const uint8_t *nonce, size_t nonceSize);
+
+// Bulletproof rewind cache create
+BulletproofRewindCache *bulletproofRewindCacheCreate(const uint8_t *nonce, size_t nonceSize);
+
+// Bulletproof rewind cache destroy
+void bulletproofRewindCacheDestroy(BulletproofRewindCache *cache);
+
+// Bulletproof rewind cache precheck
+bool bulletproofRewindCachePrecheck(const BulletproofRewindCache *cache, const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize);
+
+// Bulletproof rewind cache precheck multiple
+void bulletproofRewindCachePrecheckMultiple(const BulletproofRewindCache *cache, const uint8_t *const *proofs, const size_t *proofSizes, const uint8_t *const *commits, const size_t *commitSizes, size_t numberOfProofs, bool *results);
+
+// Bulletproof rewind cache rewind
+bool bulletproofRewindCacheRewind(const secp256k1_context *context, const BulletproofRewindCache *cache, uint64_t *value, uint8_t *blind, uint8_t *message, const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize);
+
+// Is valid compressed point
+bool isValidCompressedPoint(const uint8_t *point, uint8_t evenPrefix);
+
+// Are valid compressed points
+void areValidCompressedPoints(const uint8_t *points, size_t numberOfPoints, uint8_t evenPrefix, bool *results);
+
+// Single-signer challenge
+void singleSignerChallenge(const secp256k1_context *context, uint8_t *challenge, const secp256k1_pubkey *publicNonceTotal, const secp256k1_pubkey *publicKeyTotal, const uint8_t *message);
+
+// Verify partial single-signer signature
+bool verifyPartialSingleSignerSignature(const secp256k1_context *context, const uint8_t *signature, const uint8_t *challenge, const secp256k1_pubkey *publicKey, const secp256k1_pubkey *publicNonce, const secp256k1_pubkey *publicNonceTotal);
+
+// Verify partial single-signer signatures
+bool verifyPartialSingleSignerSignatures(const secp256k1_context *context, secp256k1_scratch_space *scratchSpace, const uint8_t *signatures, size_t numberOfSignatures, const uint8_t *challenge, const secp256k1_pubkey *publicKeys, const secp256k1_pubkey *publicNonces, const secp256k1_pubkey *publicNonceTotal, const uint8_t *seed);
+
+// Verify single-signer signatures
+bool verifySingleSignerSignatures(const secp256k1_context *context, secp256k1_scratch_space *scratchSpace, const uint8_t *signatures, const uint8_t *messages, const secp256k1_pubkey *publicKeys, size_t numberOfSignatures, const uint8_t *seed);
+
+// Multi-scalar multiply
+bool multiScalarMultiply(const secp256k1_context *context, secp256k1_scratch_space *scratchSpace, secp256k1_pubkey *result, bool *isInfinity, const secp256k1_pubkey *points, const uint8_t *scalars, size_t numberOfPoints);
+
+// Context memory usage
+size_t contextMemoryUsage(const secp256k1_context *context);
+
+// Scratch space memory usage
+size_t scratchSpaceMemoryUsage(const secp256k1_scratch_space *scratchSpace);
+
+// Generators memory usage
+size_t generatorsMemoryUsage(const secp256k1_bulletproof_generators *generators);
+
+// Verification cache key
+void verificationCacheKey(uint8_t *key, const uint8_t *salt, const uint8_t *const *items, const size_t *itemSizes, size_t numberOfItems);
+
+// SHA-256 multiple
+void sha256Multiple(uint8_t *hashes, const uint8_t *messages, size_t messageSize, size_t numberOfMessages);
+
+
+#endif
@@ -1,12 +1,33 @@
 // Header files
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cinttypes>
+#include <condition_variable>
+#include <cstdio>
 #include <cstring>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <node_api.h>
 #include <string>
+#include <thread>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
+#ifdef _WIN32
+	#define NOMINMAX
+	#include <windows.h>
+#else
+	#include <sys/mman.h>
+#endif
+
 extern "C" {
 	#include "secp256k1_bulletproofs.h"
+	#include "./internals.h"
 }
 
 using namespace std;
@@ -14,17 +35,338 @@ using namespace std;
 
 // Structures
 
+// Verification cache
+struct VerificationCache {
+
+	// Lock
+	mutex lock;
+	
+	// Salt
+	vector<uint8_t> salt;
+	
+	// Keys from most to least recently used
+	list<string> keys;
+	
+	// Entries
+	unordered_map<string, list<string>::iterator> entries;
+	
+	// Enabled
+	bool enabled;
+	
+	// Capacity
+	size_t capacity;
+	
+	// Hits
+	uint64_t hits;
+	
+	// Misses
+	uint64_t misses;
+};
+
+// Helper scratch spaces
+struct HelperScratchSpaces {
+
+	// Lock
+	mutex lock;
+	
+	// Idle
+	vector<secp256k1_scratch_space *> idle;
+	
+	// Memory usage
+	size_t memoryUsage;
+};
+
+// Secure overflow allocation
+struct SecureOverflowAllocation {
+
+	// Data
+	uint8_t *data;
+	
+	// Size
+	size_t size;
+	
+	// Locked
+	bool locked;
+	
+	// Secure arena used when the allocation was made
+	size_t secureArenaUsed;
+};
+
 // Instance data
 struct InstanceData {
 
-	// Context
-	secp256k1_context *context;
+	// Context which is atomic since worker threads read it while the JS thread can replace it with one that can verify
+	atomic<secp256k1_context *> context;
+	
+	// Context can verify
+	bool contextCanVerify;
+	
+	// Retired context
+	secp256k1_context *retiredContext;
 	
 	// Scratch space
 	secp256k1_scratch_space *scratchSpace;
 	
+	// Helper scratch spaces
+	HelperScratchSpaces helperScratchSpaces;
+	
 	// Generators
 	secp256k1_bulletproof_generators *generators;
+	
+	// Rewind context constructor
+	napi_ref rewindContextConstructor;
+	
+	// Signing session constructor
+	napi_ref signingSessionConstructor;
+	
+	// Secure arena
+	uint8_t *secureArena;
+	
+	// Secure arena used
+	size_t secureArenaUsed;
+	
+	// Secure arena locked
+	bool secureArenaLocked;
+	
+	// Secure overflow allocations
+	vector<SecureOverflowAllocation> secureOverflowAllocations;
+	
+	// Context randomization interval
+	uint32_t contextRandomizationInterval;
+	
+	// Signing operations since context randomization
+	uint32_t signingOperationsSinceContextRandomization;
+	
+	// External memory
+	int64_t externalMemory;
+	
+	// Scheduler stopping which is protected by the scheduler's lock
+	bool schedulerStopping;
+	
+	// Proof cache
+	VerificationCache proofCache;
+	
+	// Signature cache
+	VerificationCache signatureCache;
+};
+
+// Scheduler job
+struct SchedulerJob {
+
+	// Run
+	function<void(size_t threadPriority)> run;
+	
+	// Stealable
+	bool stealable;
+	
+	// Instance data
+	InstanceData *instanceData;
+	
+	// Aborted
+	shared_ptr<atomic<bool>> aborted;
+};
+
+// Scheduler
+struct Scheduler {
+
+	// Lock
+	mutex lock;
+	
+	// Job available
+	condition_variable jobAvailable;
+	
+	// Job finished
+	condition_variable jobFinished;
+	
+	// Jobs for each priority
+	array<deque<SchedulerJob>, 2> jobs;
+	
+	// Running jobs
+	list<SchedulerJob> runningJobs;
+	
+	// Number of threads for each priority which is only accessed while locked since it can be changed until the threads are started
+	array<size_t, 2> numberOfThreads;
+	
+	// Threads
+	vector<thread> threads;
+};
+
+// Abort signal
+struct AbortSignal {
+
+	// Aborted
+	shared_ptr<atomic<bool>> aborted;
+	
+	// Signal
+	napi_ref signal;
+	
+	// Listener
+	napi_ref listener;
+};
+
+// Async task
+struct AsyncTask {
+
+	// Deferred
+	napi_deferred deferred;
+	
+	// Callback
+	napi_threadsafe_function callback;
+	
+	// Execute
+	function<void(napi_threadsafe_function callback)> execute;
+	
+	// Complete
+	function<napi_value(napi_env environment)> complete;
+	
+	// Executed
+	bool executed;
+};
+
+// Parallel run
+struct ParallelRun {
+
+	// Lock
+	mutex lock;
+	
+	// Helpers finished
+	condition_variable helpersFinished;
+	
+	// Running helpers
+	size_t runningHelpers;
+	
+	// Closed
+	bool closed;
+};
+
+// Validate block task
+struct ValidateBlockTask {
+
+	// Inputs
+	vector<uint8_t> inputs;
+	
+	// Outputs
+	vector<uint8_t> outputs;
+	
+	// Proofs
+	vector<vector<uint8_t>> proofs;
+	
+	// Kernel excesses
+	vector<uint8_t> kernelExcesses;
+	
+	// Kernel signatures
+	vector<uint8_t> kernelSignatures;
+	
+	// Kernel messages
+	vector<uint8_t> kernelMessages;
+	
+	// Kernel offset
+	vector<uint8_t> kernelOffset;
+	
+	// Kernel weights seed
+	vector<uint8_t> kernelWeightsSeed;
+	
+	// Reward
+	uint64_t reward;
+	
+	// Fee
+	uint64_t fee;
+	
+	// Abort signal
+	AbortSignal abortSignal;
+	
+	// Result
+	bool result;
+};
+
+// Shared secret keys task
+struct SharedSecretKeysTask {
+
+	// Secret keys
+	vector<uint8_t> secretKeys;
+	
+	// Public keys
+	vector<uint8_t> publicKeys;
+	
+	// Shared secret keys
+	vector<uint8_t> sharedSecretKeys;
+	
+	// Abort signal
+	AbortSignal abortSignal;
+	
+	// Result
+	bool result;
+};
+
+// Rewind scan task
+struct RewindScanTask {
+
+	// Proofs
+	vector<vector<uint8_t>> proofs;
+	
+	// Commits
+	vector<uint8_t> commits;
+	
+	// Nonce
+	vector<uint8_t> nonce;
+	
+	// Abort signal
+	AbortSignal abortSignal;
+	
+	// Result
+	bool result;
+};
+
+// Rewind scan result
+struct RewindScanResult {
+
+	// Index
+	uint32_t index;
+	
+	// Value
+	vector<char> value;
+	
+	// Blind
+	vector<uint8_t> blind;
+	
+	// Message
+	vector<uint8_t> message;
+};
+
+// Rewind context
+struct RewindContext {
+
+	// Cache
+	BulletproofRewindCache *cache;
+	
+	// Nonce
+	vector<uint8_t> nonce;
+};
+
+
+// Signing session
+struct SigningSession {
+
+	// Message
+	vector<uint8_t> message;
+	
+	// Public keys
+	vector<secp256k1_pubkey> publicKeys;
+	
+	// Public nonces
+	vector<uint8_t> publicNonces;
+	
+	// Parsed public nonces
+	vector<secp256k1_pubkey> parsedPublicNonces;
+	
+	// Public key total
+	secp256k1_pubkey publicKeyTotal;
+	
+	// Public nonce total
+	secp256k1_pubkey publicNonceTotal;
+	
+	// Challenge
+	vector<uint8_t> challenge;
 };
 
 
@@ -38,17 +380,158 @@ namespace Secp256k1Zkp {
 
 // Constants
 
-// Operation failed
-static napi_value OPERATION_FAILED;
-
 // Max 64-bit integer string length
 static const size_t MAX_64_BIT_INTEGER_STRING_LENGTH = sizeof("18446744073709551615");
 
+// Blind size
+static const size_t BLIND_SIZE = 32;
+
+// Secret key size
+static const size_t SECRET_KEY_SIZE = 32;
+
+// Seed size
+static const size_t SEED_SIZE = 32;
+
+// Nonce size
+static const size_t NONCE_SIZE = 32;
+
+// Public key size
+static const size_t PUBLIC_KEY_SIZE = 33;
+
+// Uncompressed public key size
+static const size_t UNCOMPRESSED_PUBLIC_KEY_SIZE = 65;
+
+// Commit size
+static const size_t COMMIT_SIZE = 33;
+
+// Single-signer signature size
+static const size_t SINGLE_SIGNER_SIGNATURE_SIZE = 64;
+
+// Uncompact single-signer signature size
+static const size_t UNCOMPACT_SINGLE_SIGNER_SIGNATURE_SIZE = 64;
+
+// Message hash signature maximum size
+static const size_t MESSAGE_HASH_SIGNATURE_MAXIMUM_SIZE = 72;
+
+// Bulletproof proof maximum size
+static const size_t BULLETPROOF_PROOF_MAXIMUM_SIZE = 675;
+
+// Bulletproof message size
+static const size_t BULLETPROOF_MESSAGE_SIZE = 20;
+
+// Single-signer message size
+static const size_t SINGLE_SIGNER_MESSAGE_SIZE = 32;
+
+// Bulletproof number of bits
+static const size_t BULLETPROOF_NUMBER_OF_BITS = 64;
+
+// Bulletproofs per batch
+static const size_t BULLETPROOFS_PER_BATCH = 16;
+
+// Kernels per batch
+static const size_t KERNELS_PER_BATCH = 64;
+
+// Commits per batch
+static const size_t COMMITS_PER_BATCH = 256;
+
+// Random weights seed size
+static const size_t RANDOM_WEIGHTS_SEED_SIZE = 32;
+
+// SHA-256 hash size
+static const size_t SHA256_HASH_SIZE = 32;
+
+// Shared secret keys per batch
+static const size_t SHARED_SECRET_KEYS_PER_BATCH = 64;
+
+// Format checks per batch
+static const size_t FORMAT_CHECKS_PER_BATCH = 1024;
+
+// Commit even prefix
+static const uint8_t COMMIT_EVEN_PREFIX = 0x08;
+
+// Public key even prefix
+static const uint8_t PUBLIC_KEY_EVEN_PREFIX = 0x02;
+
+// Secure arena size
+static const size_t SECURE_ARENA_SIZE = 64 * 1024;
+
+// Secure arena alignment
+static const size_t SECURE_ARENA_ALIGNMENT = alignof(max_align_t);
+
+// Streamed events queue size
+static const size_t STREAMED_EVENTS_QUEUE_SIZE = 64;
+
+// Rewind scan progress interval
+static const uint32_t REWIND_SCAN_PROGRESS_INTERVAL = 1024;
+
+// Validation progress interval
+static const size_t VALIDATION_PROGRESS_INTERVAL = 1024;
+
+// Stream event retry delay
+static const chrono::milliseconds STREAM_EVENT_RETRY_DELAY(1);
+
+// Rewind scan prechecks per batch
+static const uint32_t REWIND_SCAN_PRECHECKS_PER_BATCH = 64;
+
+// Verification cache salt size
+static const size_t VERIFICATION_CACHE_SALT_SIZE = 32;
+
+// Verification cache key size
+static const size_t VERIFICATION_CACHE_KEY_SIZE = 32;
+
+// Verification cache entry memory usage which includes the key's allocation, the list node, and the hash table node and bucket
+static const size_t VERIFICATION_CACHE_ENTRY_MEMORY_USAGE = (VERIFICATION_CACHE_KEY_SIZE + 1) + (2 * sizeof(void *) + sizeof(string)) + (2 * sizeof(void *) + sizeof(string) + sizeof(list<string>::iterator)) + sizeof(void *);
+
+// Signature cache default size
+static const size_t SIGNATURE_CACHE_DEFAULT_SIZE = 32 * 1024 * 1024;
+
+// Single-signer signature cache tag
+static const uint8_t SINGLE_SIGNER_SIGNATURE_CACHE_TAG = 0;
+
+// Message hash signature cache tag
+static const uint8_t MESSAGE_HASH_SIGNATURE_CACHE_TAG = 1;
+
+// Interactive priority
+static const size_t INTERACTIVE_PRIORITY = 0;
+
+// Bulk priority
+static const size_t BULK_PRIORITY = 1;
+
+// Verify capability
+static const unsigned int VERIFY_CAPABILITY = 1 << 0;
+
+// Scratch space capability
+static const unsigned int SCRATCH_SPACE_CAPABILITY = 1 << 1;
+
+// Generators capability
+static const unsigned int GENERATORS_CAPABILITY = 1 << 2;
+
+// Rewind context type tag
+static const napi_type_tag REWIND_CONTEXT_TYPE_TAG = {0xB895A286E5934FF3, 0xB49875DD3C6365F9};
+
+// Signing session type tag
+static const napi_type_tag SIGNING_SESSION_TYPE_TAG = {0xFD1007C83CEC4282, 0xBE0BAABDFDB21F70};
+
 
 // Function prototypes
 
 // Get instance data
-static InstanceData *getInstanceData(napi_env environment);
+static InstanceData *getInstanceData(napi_env environment, unsigned int capabilities = 0);
+
+// Randomize context which is the instance data's context if no context is provided
+static bool randomizeContext(napi_env environment, InstanceData *instanceData, secp256k1_context *context = nullptr);
+
+// Count signing operation
+static void countSigningOperation(napi_env environment, InstanceData *instanceData);
+
+// Get instance memory usage
+static tuple<size_t, size_t, size_t, size_t, size_t, size_t> getInstanceMemoryUsage(InstanceData *instanceData);
+
+// Update external memory
+static void updateExternalMemory(napi_env environment, InstanceData *instanceData);
+
+// Get arguments
+template<size_t numberOfArguments> static bool getArguments(napi_env environment, napi_callback_info arguments, array<napi_value, numberOfArguments> &argv, napi_value *thisArgument = nullptr, size_t numberOfOptionalArguments = 0);
 
 // Blind switch
 static napi_value blindSwitch(napi_env environment, napi_callback_info arguments);
@@ -65,6 +548,18 @@ static napi_value isValidPublicKey(napi_env environment, napi_callback_info argu
 // Is valid commit
 static napi_value isValidCommit(napi_env environment, napi_callback_info arguments);
 
+// Are valid secret keys
+static napi_value areValidSecretKeys(napi_env environment, napi_callback_info arguments);
+
+// Are valid public keys
+static napi_value areValidPublicKeys(napi_env environment, napi_callback_info arguments);
+
+// Are valid commits
+static napi_value areValidCommits(napi_env environment, napi_callback_info arguments);
+
+// SHA-256 multiple
+static napi_value sha256Multiple(napi_env environment, napi_callback_info arguments);
+
 // Is valid single-signer signature
 static napi_value isValidSingleSignerSignature(napi_env environment, napi_callback_info arguments);
 
@@ -77,9 +572,30 @@ static napi_value createBulletproofBlindless(napi_env environment, napi_callback
 // Rewind bulletproof
 static napi_value rewindBulletproof(napi_env environment, napi_callback_info arguments);
 
+// Can rewind bulletproof
+static napi_value canRewindBulletproof(napi_env environment, napi_callback_info arguments);
+
 // Verify bulletproof
 static napi_value verifyBulletproof(napi_env environment, napi_callback_info arguments);
 
+// Create rewind context
+static napi_value createRewindContext(napi_env environment, napi_callback_info arguments);
+
+// Rewind context can rewind
+static napi_value rewindContextCanRewind(napi_env environment, napi_callback_info arguments);
+
+// Rewind context rewind
+static napi_value rewindContextRewind(napi_env environment, napi_callback_info arguments);
+
+// Rewind context scan
+static napi_value rewindContextScan(napi_env environment, napi_callback_info arguments);
+
+// Validate block
+static napi_value validateBlock(napi_env environment, napi_callback_info arguments);
+
+// Validate transaction
+static napi_value validateTransaction(napi_env environment, napi_callback_info arguments);
+
 // Public key from secret key
 static napi_value publicKeyFromSecretKey(napi_env environment, napi_callback_info arguments);
 
@@ -104,6 +620,9 @@ static napi_value publicKeyTweakMultiply(napi_env environment, napi_callback_inf
 // Shared secret key from secret key and public key
 static napi_value sharedSecretKeyFromSecretKeyAndPublicKey(napi_env environment, napi_callback_info arguments);
 
+// Shared secret keys from secret keys and public keys
+static napi_value sharedSecretKeysFromSecretKeysAndPublicKeys(napi_env environment, napi_callback_info arguments);
+
 // Pedersen commit
 static napi_value pedersenCommit(napi_env environment, napi_callback_info arguments);
 
@@ -137,6 +656,60 @@ static napi_value uncompactSingleSignerSignature(napi_env environment, napi_call
 // Combine public keys
 static napi_value combinePublicKeys(napi_env environment, napi_callback_info arguments);
 
+// Multi-scalar multiply
+static napi_value multiScalarMultiply(napi_env environment, napi_callback_info arguments);
+
+// Create signing session
+static napi_value createSigningSession(napi_env environment, napi_callback_info arguments);
+
+// Signing session get public key total
+static napi_value signingSessionGetPublicKeyTotal(napi_env environment, napi_callback_info arguments);
+
+// Signing session get public nonce total
+static napi_value signingSessionGetPublicNonceTotal(napi_env environment, napi_callback_info arguments);
+
+// Signing session create partial signature
+static napi_value signingSessionCreatePartialSignature(napi_env environment, napi_callback_info arguments);
+
+// Signing session verify partial signature
+static napi_value signingSessionVerifyPartialSignature(napi_env environment, napi_callback_info arguments);
+
+// Signing session verify partial signatures
+static napi_value signingSessionVerifyPartialSignatures(napi_env environment, napi_callback_info arguments);
+
+// Signing session add partial signatures
+static napi_value signingSessionAddPartialSignatures(napi_env environment, napi_callback_info arguments);
+
+// Signing session verify signature
+static napi_value signingSessionVerifySignature(napi_env environment, napi_callback_info arguments);
+
+// Rerandomize context
+static napi_value rerandomizeContext(napi_env environment, napi_callback_info arguments);
+
+// Set context randomization interval
+static napi_value setContextRandomizationInterval(napi_env environment, napi_callback_info arguments);
+
+// Get memory usage
+static napi_value getMemoryUsage(napi_env environment, napi_callback_info arguments);
+
+// Set scheduler threads
+static napi_value setSchedulerThreads(napi_env environment, napi_callback_info arguments);
+
+// Set proof cache capacity
+static napi_value setProofCacheCapacity(napi_env environment, napi_callback_info arguments);
+
+// Get proof cache statistics
+static napi_value getProofCacheStatistics(napi_env environment, napi_callback_info arguments);
+
+// Set signature cache size
+static napi_value setSignatureCacheSize(napi_env environment, napi_callback_info arguments);
+
+// Set signature cache enabled
+static napi_value setSignatureCacheEnabled(napi_env environment, napi_callback_info arguments);
+
+// Get signature cache statistics
+static napi_value getSignatureCacheStatistics(napi_env environment, napi_callback_info arguments);
+
 // Create secret nonce
 static napi_value createSecretNonce(napi_env environment, napi_callback_info arguments);
 
@@ -146,17 +719,125 @@ static napi_value createMessageHashSignature(napi_env environment, napi_callback
 // Verify message hash signature
 static napi_value verifyMessageHashSignature(napi_env environment, napi_callback_info arguments);
 
+// Get signing session
+static tuple<SigningSession *, bool> getSigningSession(napi_env environment, napi_value thisArgument);
+
+// Serialize public key
+static napi_value serializePublicKey(napi_env environment, InstanceData *instanceData, const secp256k1_pubkey *publicKey);
+
+// Perform batch format check
+static napi_value performBatchFormatCheck(napi_env environment, napi_callback_info arguments, size_t itemSize, const function<void(const uint8_t *items, size_t numberOfItems, bool *results)> &areValid);
+
+// Get rewind context
+static tuple<RewindContext *, bool> getRewindContext(napi_env environment, napi_value thisArgument);
+
+// Rewind bulletproof with cache
+static bool rewindBulletproofWithCache(const secp256k1_context *context, const BulletproofRewindCache *cache, char *value, uint8_t *blind, uint8_t *message, const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize);
+
+// Perform rewind bulletproof
+static napi_value performRewindBulletproof(napi_env environment, InstanceData *instanceData, const function<bool(char *value, uint8_t *blind, uint8_t *message)> &rewind);
+
+// Perform validation
+static napi_value performValidation(napi_env environment, napi_callback_info arguments, const char *name, bool isBlock);
+
+// Validate block task execute
+static bool validateBlockTaskExecute(InstanceData *instanceData, const ValidateBlockTask &task, napi_threadsafe_function callback);
+
+// Queue async task
+static napi_value queueAsyncTask(napi_env environment, const char *name, size_t priority, const shared_ptr<atomic<bool>> &aborted, const function<void()> &execute, const function<napi_value(napi_env environment)> &complete);
+
+// Clear rewind scan result
+static void clearRewindScanResult(RewindScanResult &result);
+
+// Queue streaming async task
+static napi_value queueStreamingAsyncTask(napi_env environment, const char *name, napi_value callback, size_t priority, const shared_ptr<atomic<bool>> &aborted, const function<void(napi_threadsafe_function callback)> &execute, const function<napi_value(napi_env environment)> &complete);
+
+// Get abort signal
+static bool getAbortSignal(napi_env environment, napi_value value, AbortSignal &abortSignal);
+
+// Release abort signal
+static void releaseAbortSignal(napi_env environment, AbortSignal &abortSignal);
+
+// Stream event
+static bool streamEvent(napi_threadsafe_function callback, const atomic<bool> *aborted, const function<void(napi_env environment, napi_value callback)> &event);
+
+// Run in parallel
+static bool runInParallel(InstanceData *instanceData, size_t priority, const secp256k1_context *context, size_t numberOfItems, size_t itemsPerBatch, const function<bool(size_t start, size_t end, secp256k1_scratch_space *scratchSpace)> &batchFunction, const atomic<bool> *aborted = nullptr);
+
+// Acquire helper scratch space
+static secp256k1_scratch_space *acquireHelperScratchSpace(InstanceData *instanceData, const secp256k1_context *context);
+
+// Release helper scratch space
+static void releaseHelperScratchSpace(InstanceData *instanceData, secp256k1_scratch_space *scratchSpace);
+
+// Get scheduler
+static Scheduler *getScheduler();
+
+// Schedule job
+static bool scheduleJob(InstanceData *instanceData, size_t priority, bool stealable, const shared_ptr<atomic<bool>> &aborted, const function<void(size_t threadPriority)> &run);
+
+// Run scheduler thread
+static void runSchedulerThread(Scheduler *scheduler, size_t priority);
+
+// Has scheduled jobs
+static bool hasScheduledJobs(Scheduler *scheduler, size_t priority);
+
+// Stop scheduler
+static void stopScheduler(InstanceData *instanceData);
+
+// Configure verification cache
+static bool configureVerificationCache(napi_env environment, VerificationCache *cache, bool enabled, size_t capacity);
+
+// Verification cache contains
+static bool verificationCacheContains(VerificationCache *cache, string &key, const vector<tuple<const uint8_t *, size_t>> &items);
+
+// Verification cache add
+static bool verificationCacheAdd(VerificationCache *cache, const string &key);
+
+// Verification cache memory usage
+static size_t verificationCacheMemoryUsage(VerificationCache *cache);
+
+// Get verification cache statistics
+static napi_value getVerificationCacheStatistics(napi_env environment, VerificationCache *cache);
+
+// Create secure arena
+static uint8_t *createSecureArena(size_t size, bool &locked);
+
+// Destroy secure arena
+static void destroySecureArena(uint8_t *secureArena, size_t size, bool locked);
+
+// Secure allocate
+static uint8_t *secureAllocate(InstanceData *instanceData, size_t size);
+
+// Secure free which also releases everything allocated after the data so allocations must be freed in the reverse order that they were made
+static void secureFree(InstanceData *instanceData, uint8_t *data);
+
+// Secure clear
+static void secureClear(void *data, size_t size);
+
+// Packed uint8 array to buffer
+static tuple<uint8_t *, size_t, bool> packedUint8ArrayToBuffer(napi_env environment, napi_value uint8Array, size_t itemSize);
+
 // Uint8 array to buffer
 static tuple<uint8_t *, size_t, bool> uint8ArrayToBuffer(napi_env environment, napi_value uint8Array);
 
 // Buffer to uint8 array
 static napi_value bufferToUint8Array(napi_env environment, uint8_t *data, size_t size);
 
+// Operation failed
+static napi_value operationFailed(napi_env environment);
+
+// Point at infinity
+static napi_value pointAtInfinity(napi_env environment);
+
 // C bool to bool
 static napi_value cBoolToBool(napi_env environment, bool value);
 
 // String to C string
-static tuple<string, bool> stringToCString(napi_env environment, napi_value value);
+template<size_t size> static bool stringToCString(napi_env environment, napi_value value, array<char, size> &result);
+
+// String to uint64
+static bool stringToUint64(napi_env environment, napi_value value, uint64_t &result);
 
 // Random fill
 static bool randomFill(napi_env environment, uint8_t *buffer, size_t size);
@@ -180,8 +861,28 @@ NAPI_MODULE_INIT() {
 	
 	// Initialize instance data
 	instanceData->context = nullptr;
+	instanceData->contextCanVerify = false;
+	instanceData->retiredContext = nullptr;
 	instanceData->scratchSpace = nullptr;
+	instanceData->helperScratchSpaces.memoryUsage = 0;
 	instanceData->generators = nullptr;
+	instanceData->rewindContextConstructor = nullptr;
+	instanceData->signingSessionConstructor = nullptr;
+	instanceData->secureArena = nullptr;
+	instanceData->secureArenaUsed = 0;
+	instanceData->secureArenaLocked = false;
+	instanceData->contextRandomizationInterval = 0;
+	instanceData->signingOperationsSinceContextRandomization = 0;
+	instanceData->externalMemory = 0;
+	instanceData->schedulerStopping = false;
+	instanceData->proofCache.enabled = true;
+	instanceData->proofCache.capacity = 0;
+	instanceData->proofCache.hits = 0;
+	instanceData->proofCache.misses = 0;
+	instanceData->signatureCache.enabled = false;
+	instanceData->signatureCache.capacity = SIGNATURE_CACHE_DEFAULT_SIZE / VERIFICATION_CACHE_ENTRY_MEMORY_USAGE;
+	instanceData->signatureCache.hits = 0;
+	instanceData->signatureCache.misses = 0;
 	
 	// Check if associating instance data with the instance failed
 	if(napi_set_instance_data(env, instanceData, [](napi_env environment, void *finalizeData, void *finalizeHint) {
@@ -189,6 +890,23 @@ NAPI_MODULE_INIT() {
 		// Get instance data
 		InstanceData *instanceData = reinterpret_cast<InstanceData *>(finalizeData);
 		
+		// Stop the instance data's scheduler jobs before anything they could be using is destroyed
+		stopScheduler(instanceData);
+		
+		// Check if instance data's rewind context constructor exists
+		if(instanceData->rewindContextConstructor) {
+		
+			// Delete instance data's rewind context constructor
+			napi_delete_reference(environment, instanceData->rewindContextConstructor);
+		}
+		
+		// Check if instance data's signing session constructor exists
+		if(instanceData->signingSessionConstructor) {
+		
+			// Delete instance data's signing session constructor
+			napi_delete_reference(environment, instanceData->signingSessionConstructor);
+		}
+		
 		// Check if instance data's generators exist
 		if(instanceData->generators) {
 		
@@ -203,6 +921,13 @@ NAPI_MODULE_INIT() {
 			secp256k1_scratch_space_destroy(instanceData->scratchSpace);
 		}
 		
+		// Go through all of the instance data's helper scratch spaces which are all idle since its scheduler jobs are stopped
+		for(secp256k1_scratch_space *scratchSpace : instanceData->helperScratchSpaces.idle) {
+		
+			// Destroy helper scratch space
+			secp256k1_scratch_space_destroy(scratchSpace);
+		}
+		
 		// Check if instance data's context exists
 		if(instanceData->context) {
 		
@@ -210,17 +935,39 @@ NAPI_MODULE_INIT() {
 			secp256k1_context_destroy(instanceData->context);
 		}
 		
-		// Free memory
-		delete instanceData;
+		// Check if instance data's retired context exists
+		if(instanceData->retiredContext) {
 		
-	}, nullptr) != napi_ok) {
-	
-		// Return nothing
-		return nullptr;
-	}
-	
-	// Check if initializing operation failed failed
-	if(napi_get_null(env, &OPERATION_FAILED) != napi_ok) {
+			// Destroy instance data's retired context
+			secp256k1_context_destroy(instanceData->retiredContext);
+		}
+		
+		// Go through all of the instance data's secure overflow allocations
+		for(const SecureOverflowAllocation &secureOverflowAllocation : instanceData->secureOverflowAllocations) {
+		
+			// Destroy secure overflow allocation
+			destroySecureArena(secureOverflowAllocation.data, secureOverflowAllocation.size, secureOverflowAllocation.locked);
+		}
+		
+		// Check if instance data's secure arena exists
+		if(instanceData->secureArena) {
+		
+			// Destroy instance data's secure arena
+			destroySecureArena(instanceData->secureArena, SECURE_ARENA_SIZE, instanceData->secureArenaLocked);
+		}
+		
+		// Check if memory was reported to the garbage collector
+		if(instanceData->externalMemory) {
+		
+			// Remove the reported memory from the garbage collector
+			int64_t adjustedValue;
+			napi_adjust_external_memory(environment, -instanceData->externalMemory, &adjustedValue);
+		}
+		
+		// Free memory
+		delete instanceData;
+		
+	}, nullptr) != napi_ok) {
 	
 		// Return nothing
 		return nullptr;
@@ -262,6 +1009,34 @@ NAPI_MODULE_INIT() {
 		return nullptr;
 	}
 	
+	// Check if creating are valid secret keys property failed
+	if(napi_create_function(env, nullptr, 0, areValidSecretKeys, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "areValidSecretKeys", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if creating are valid public keys property failed
+	if(napi_create_function(env, nullptr, 0, areValidPublicKeys, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "areValidPublicKeys", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if creating are valid commits property failed
+	if(napi_create_function(env, nullptr, 0, areValidCommits, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "areValidCommits", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if creating SHA-256 multiple property failed
+	if(napi_create_function(env, nullptr, 0, sha256Multiple, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "sha256Multiple", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
 	// Check if creating is valid single-signer signature property failed
 	if(napi_create_function(env, nullptr, 0, isValidSingleSignerSignature, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "isValidSingleSignerSignature", temp) != napi_ok) {
 	
@@ -290,6 +1065,13 @@ NAPI_MODULE_INIT() {
 		return nullptr;
 	}
 	
+	// Check if creating can rewind bulletproof property failed
+	if(napi_create_function(env, nullptr, 0, canRewindBulletproof, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "canRewindBulletproof", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
 	// Check if creating verify bulletproof property failed
 	if(napi_create_function(env, nullptr, 0, verifyBulletproof, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "verifyBulletproof", temp) != napi_ok) {
 	
@@ -297,6 +1079,52 @@ NAPI_MODULE_INIT() {
 		return nullptr;
 	}
 	
+	// Check if creating create rewind context property failed
+	if(napi_create_function(env, nullptr, 0, createRewindContext, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "createRewindContext", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if creating rewind context class failed
+	const napi_property_descriptor rewindContextProperties[] = {
+		{"canRewind", nullptr, rewindContextCanRewind, nullptr, nullptr, nullptr, napi_default, nullptr},
+		{"rewind", nullptr, rewindContextRewind, nullptr, nullptr, nullptr, napi_default, nullptr},
+		{"scan", nullptr, rewindContextScan, nullptr, nullptr, nullptr, napi_default, nullptr}
+	};
+	if(napi_define_class(env, "RewindContext", NAPI_AUTO_LENGTH, [](napi_env environment, napi_callback_info arguments) -> napi_value {
+	
+		// Check if getting this failed
+		napi_value thisArgument;
+		if(napi_get_cb_info(environment, arguments, nullptr, nullptr, &thisArgument, nullptr) != napi_ok) {
+		
+			// Return nothing
+			return nullptr;
+		}
+		
+		// Return this
+		return thisArgument;
+		
+	}, nullptr, sizeof(rewindContextProperties) / sizeof(rewindContextProperties[0]), rewindContextProperties, &temp) != napi_ok || napi_create_reference(env, temp, 1, &instanceData->rewindContextConstructor) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if creating validate block property failed
+	if(napi_create_function(env, nullptr, 0, validateBlock, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "validateBlock", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if creating validate transaction property failed
+	if(napi_create_function(env, nullptr, 0, validateTransaction, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "validateTransaction", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
 	// Check if creating public key from secret key property failed
 	if(napi_create_function(env, nullptr, 0, publicKeyFromSecretKey, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "publicKeyFromSecretKey", temp) != napi_ok) {
 	
@@ -353,6 +1181,13 @@ NAPI_MODULE_INIT() {
 		return nullptr;
 	}
 	
+	// Check if creating shared secret keys from secret keys and public keys property failed
+	if(napi_create_function(env, nullptr, 0, sharedSecretKeysFromSecretKeysAndPublicKeys, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "sharedSecretKeysFromSecretKeysAndPublicKeys", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
 	// Check if creating pedersen commit property failed
 	if(napi_create_function(env, nullptr, 0, pedersenCommit, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "pedersenCommit", temp) != napi_ok) {
 	
@@ -430,6 +1265,112 @@ NAPI_MODULE_INIT() {
 		return nullptr;
 	}
 	
+	// Check if creating multi-scalar multiply property failed
+	if(napi_create_function(env, nullptr, 0, multiScalarMultiply, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "multiScalarMultiply", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if creating create signing session property failed
+	if(napi_create_function(env, nullptr, 0, createSigningSession, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "createSigningSession", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if creating signing session class failed
+	const napi_property_descriptor signingSessionProperties[] = {
+		{"getPublicKeyTotal", nullptr, signingSessionGetPublicKeyTotal, nullptr, nullptr, nullptr, napi_default, nullptr},
+		{"getPublicNonceTotal", nullptr, signingSessionGetPublicNonceTotal, nullptr, nullptr, nullptr, napi_default, nullptr},
+		{"createPartialSignature", nullptr, signingSessionCreatePartialSignature, nullptr, nullptr, nullptr, napi_default, nullptr},
+		{"verifyPartialSignature", nullptr, signingSessionVerifyPartialSignature, nullptr, nullptr, nullptr, napi_default, nullptr},
+		{"verifyPartialSignatures", nullptr, signingSessionVerifyPartialSignatures, nullptr, nullptr, nullptr, napi_default, nullptr},
+		{"addPartialSignatures", nullptr, signingSessionAddPartialSignatures, nullptr, nullptr, nullptr, napi_default, nullptr},
+		{"verifySignature", nullptr, signingSessionVerifySignature, nullptr, nullptr, nullptr, napi_default, nullptr}
+	};
+	if(napi_define_class(env, "SigningSession", NAPI_AUTO_LENGTH, [](napi_env environment, napi_callback_info arguments) -> napi_value {
+	
+		// Check if getting this failed
+		napi_value thisArgument;
+		if(napi_get_cb_info(environment, arguments, nullptr, nullptr, &thisArgument, nullptr) != napi_ok) {
+		
+			// Return nothing
+			return nullptr;
+		}
+		
+		// Return this
+		return thisArgument;
+		
+	}, nullptr, sizeof(signingSessionProperties) / sizeof(signingSessionProperties[0]), signingSessionProperties, &temp) != napi_ok || napi_create_reference(env, temp, 1, &instanceData->signingSessionConstructor) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if creating rerandomize context property failed
+	if(napi_create_function(env, nullptr, 0, rerandomizeContext, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "rerandomizeContext", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if creating set context randomization interval property failed
+	if(napi_create_function(env, nullptr, 0, setContextRandomizationInterval, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "setContextRandomizationInterval", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if creating get memory usage property failed
+	if(napi_create_function(env, nullptr, 0, getMemoryUsage, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "getMemoryUsage", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if creating set scheduler threads property failed
+	if(napi_create_function(env, nullptr, 0, setSchedulerThreads, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "setSchedulerThreads", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if creating set proof cache capacity property failed
+	if(napi_create_function(env, nullptr, 0, setProofCacheCapacity, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "setProofCacheCapacity", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if creating get proof cache statistics property failed
+	if(napi_create_function(env, nullptr, 0, getProofCacheStatistics, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "getProofCacheStatistics", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if creating set signature cache size property failed
+	if(napi_create_function(env, nullptr, 0, setSignatureCacheSize, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "setSignatureCacheSize", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if creating set signature cache enabled property failed
+	if(napi_create_function(env, nullptr, 0, setSignatureCacheEnabled, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "setSignatureCacheEnabled", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if creating get signature cache statistics property failed
+	if(napi_create_function(env, nullptr, 0, getSignatureCacheStatistics, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "getSignatureCacheStatistics", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
 	// Check if creating create secret nonce property failed
 	if(napi_create_function(env, nullptr, 0, createSecretNonce, nullptr, &temp) != napi_ok || napi_set_named_property(env, exports, "createSecretNonce", temp) != napi_ok) {
 	
@@ -451,8 +1392,53 @@ NAPI_MODULE_INIT() {
 		return nullptr;
 	}
 	
+	// Check if sizes don't match the sizes used by Secp256k1-zkp
+	if(Secp256k1Zkp::blindSize(instanceData) != BLIND_SIZE || Secp256k1Zkp::secretKeySize(instanceData) != SECRET_KEY_SIZE || Secp256k1Zkp::seedSize(instanceData) != SEED_SIZE || Secp256k1Zkp::nonceSize(instanceData) != NONCE_SIZE || Secp256k1Zkp::publicKeySize(instanceData) != PUBLIC_KEY_SIZE || Secp256k1Zkp::uncompressedPublicKeySize(instanceData) != UNCOMPRESSED_PUBLIC_KEY_SIZE || Secp256k1Zkp::commitSize(instanceData) != COMMIT_SIZE || Secp256k1Zkp::singleSignerSignatureSize(instanceData) != SINGLE_SIGNER_SIGNATURE_SIZE || Secp256k1Zkp::uncompactSingleSignerSignatureSize(instanceData) != UNCOMPACT_SINGLE_SIGNER_SIGNATURE_SIZE || Secp256k1Zkp::maximumMessageHashSignatureSize(instanceData) != MESSAGE_HASH_SIGNATURE_MAXIMUM_SIZE || Secp256k1Zkp::bulletproofProofSize(instanceData) != BULLETPROOF_PROOF_MAXIMUM_SIZE || Secp256k1Zkp::bulletproofMessageSize(instanceData) != BULLETPROOF_MESSAGE_SIZE) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Go through all sizes
+	const array<tuple<const char *, size_t>, 13> sizes = {{
+		{"BLIND_SIZE", BLIND_SIZE},
+		{"SECRET_KEY_SIZE", SECRET_KEY_SIZE},
+		{"SECRET_NONCE_SIZE", NONCE_SIZE},
+		{"PUBLIC_KEY_SIZE", PUBLIC_KEY_SIZE},
+		{"UNCOMPRESSED_PUBLIC_KEY_SIZE", UNCOMPRESSED_PUBLIC_KEY_SIZE},
+		{"COMMIT_SIZE", COMMIT_SIZE},
+		{"SIGNATURE_SIZE", SINGLE_SIGNER_SIGNATURE_SIZE},
+		{"UNCOMPACT_SIGNATURE_SIZE", UNCOMPACT_SINGLE_SIGNER_SIGNATURE_SIZE},
+		{"SIGNATURE_MESSAGE_SIZE", SINGLE_SIGNER_MESSAGE_SIZE},
+		{"MESSAGE_HASH_SIGNATURE_MAX_SIZE", MESSAGE_HASH_SIGNATURE_MAXIMUM_SIZE},
+		{"PROOF_MAX_SIZE", BULLETPROOF_PROOF_MAXIMUM_SIZE},
+		{"PROOF_MESSAGE_SIZE", BULLETPROOF_MESSAGE_SIZE},
+		{"PROOF_NUMBER_OF_BITS", BULLETPROOF_NUMBER_OF_BITS}
+	}};
+	array<napi_property_descriptor, tuple_size<decltype(sizes)>::value> sizeProperties;
+	for(size_t i = 0; i < sizes.size(); ++i) {
+	
+		// Check if creating size failed
+		napi_value size;
+		if(napi_create_uint32(env, static_cast<uint32_t>(get<1>(sizes[i])), &size) != napi_ok) {
+		
+			// Return nothing
+			return nullptr;
+		}
+		
+		// Set size's property as a read-only value
+		sizeProperties[i] = {get<0>(sizes[i]), nullptr, nullptr, nullptr, nullptr, size, napi_enumerable, nullptr};
+	}
+	
+	// Check if creating size properties failed
+	if(napi_define_properties(env, exports, sizeProperties.size(), sizeProperties.data()) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
 	// Check if creating operation failed property failed
-	if(napi_set_named_property(env, exports, "OPERATION_FAILED", OPERATION_FAILED) != napi_ok) {
+	if(napi_get_null(env, &temp) != napi_ok || napi_set_named_property(env, exports, "OPERATION_FAILED", temp) != napi_ok) {
 	
 		// Return nothing
 		return nullptr;
@@ -479,6 +1465,13 @@ NAPI_MODULE_INIT() {
 		return nullptr;
 	}
 	
+	// Check if creating point at infinity property failed
+	if(napi_get_boolean(env, false, &temp) != napi_ok || napi_set_named_property(env, exports, "POINT_AT_INFINITY", temp) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
 	// Return exports
 	return exports;
 }
@@ -487,7 +1480,7 @@ NAPI_MODULE_INIT() {
 // Supporting function implementation
 
 // Get instance data
-InstanceData *getInstanceData(napi_env environment) {
+InstanceData *getInstanceData(napi_env environment, unsigned int capabilities) {
 
 	// Check if getting instance data failed
 	InstanceData *instanceData;
@@ -497,41 +1490,85 @@ InstanceData *getInstanceData(napi_env environment) {
 		return nullptr;
 	}
 	
+	// Check if instance data's secure arena doesn't exist
+	if(!instanceData->secureArena) {
+	
+		// Check if creating instance data's secure arena failed
+		instanceData->secureArena = createSecureArena(SECURE_ARENA_SIZE, instanceData->secureArenaLocked);
+		if(!instanceData->secureArena) {
+		
+			// Return nothing
+			return nullptr;
+		}
+		
+		// Update external memory
+		updateExternalMemory(environment, instanceData);
+	}
+	
 	// Check if instance data's context doesn't exist
 	if(!instanceData->context) {
 	
-		// Check if creating instance data's context failed
-		instanceData->context = secp256k1_context_create(SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY);
-		if(!instanceData->context) {
+		// Check if creating context with only the verify tables that are required failed
+		secp256k1_context *context = secp256k1_context_create((capabilities & VERIFY_CAPABILITY) ? SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY : SECP256K1_CONTEXT_SIGN);
+		if(!context) {
 		
 			// Return nothing
 			return nullptr;
 		}
 		
-		// Check if creating random seed failed
-		vector<uint8_t> seed(Secp256k1Zkp::seedSize(instanceData));
-		if(!randomFill(environment, seed.data(), seed.size())) {
+		// Check if randomizing context before it's published failed
+		if(!randomizeContext(environment, instanceData, context)) {
 		
+			// Destroy context since it was never published
+			secp256k1_context_destroy(context);
+			
 			// Return nothing
 			return nullptr;
 		}
 		
-		// Check if randomizing context failed
-		if(!secp256k1_context_randomize(instanceData->context, seed.data())) {
+		// Set instance data's context to the randomized context
+		instanceData->context = context;
+		
+		// Set instance data's context can verify
+		instanceData->contextCanVerify = capabilities & VERIFY_CAPABILITY;
+		
+		// Update external memory
+		updateExternalMemory(environment, instanceData);
+	}
+	
+	// Otherwise check if verifying is required and instance data's context can't verify
+	else if((capabilities & VERIFY_CAPABILITY) && !instanceData->contextCanVerify) {
+	
+		// Check if creating context that can verify failed
+		secp256k1_context *context = secp256k1_context_create(SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY);
+		if(!context) {
+		
+			// Return nothing
+			return nullptr;
+		}
 		
-			// Clear seed
-			memset(seed.data(), 0, seed.size());
+		// Check if randomizing context before it's published failed
+		if(!randomizeContext(environment, instanceData, context)) {
 		
+			// Destroy context since it was never published
+			secp256k1_context_destroy(context);
+			
 			// Return nothing
 			return nullptr;
 		}
 		
-		// Clear seed
-		memset(seed.data(), 0, seed.size());
+		// Atomically replace instance data's context with the randomized context and retire the old one instead of destroying it since running and queued tasks may still be using it until its scheduler jobs are stopped
+		instanceData->retiredContext = instanceData->context.exchange(context);
+		
+		// Set instance data's context can verify
+		instanceData->contextCanVerify = true;
+		
+		// Update external memory
+		updateExternalMemory(environment, instanceData);
 	}
 	
-	// Check if instance data's scratch space doesn't exist
-	if(!instanceData->scratchSpace) {
+	// Check if a scratch space is required and instance data's scratch space doesn't exist
+	if((capabilities & SCRATCH_SPACE_CAPABILITY) && !instanceData->scratchSpace) {
 	
 		// Check if creating instance data's scratch space failed
 		instanceData->scratchSpace = secp256k1_scratch_space_create(instanceData->context, Secp256k1Zkp::SCRATCH_SPACE_SIZE);
@@ -540,10 +1577,13 @@ InstanceData *getInstanceData(napi_env environment) {
 			// Return nothing
 			return nullptr;
 		}
+		
+		// Update external memory
+		updateExternalMemory(environment, instanceData);
 	}
 	
-	// Check if instance data's generators doesn't exist
-	if(!instanceData->generators) {
+	// Check if generators are required and instance data's generators doesn't exist
+	if((capabilities & GENERATORS_CAPABILITY) && !instanceData->generators) {
 	
 		// Check if creating instance data's generators failed
 		instanceData->generators = secp256k1_bulletproof_generators_create(instanceData->context, &secp256k1_generator_const_g, Secp256k1Zkp::NUMBER_OF_GENERATORS);
@@ -552,30 +1592,146 @@ InstanceData *getInstanceData(napi_env environment) {
 			// Return nothing
 			return nullptr;
 		}
+		
+		// Update external memory
+		updateExternalMemory(environment, instanceData);
 	}
 	
 	// Return instance data
 	return instanceData;
 }
 
+// Randomize context
+bool randomizeContext(napi_env environment, InstanceData *instanceData, secp256k1_context *context) {
+
+	// Check if allocating seed failed
+	uint8_t *seed = secureAllocate(instanceData, SEED_SIZE);
+	if(!seed) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if creating random seed failed
+	if(!randomFill(environment, seed, SEED_SIZE)) {
+	
+		// Free seed
+		secureFree(instanceData, seed);
+		
+		// Return false
+		return false;
+	}
+	
+	// Check if randomizing the context or instance data's context in place failed
+	if(!secp256k1_context_randomize(context ? context : instanceData->context.load(), seed)) {
+	
+		// Free seed
+		secureFree(instanceData, seed);
+		
+		// Return false
+		return false;
+	}
+	
+	// Free seed
+	secureFree(instanceData, seed);
+	
+	// Reset signing operations since context randomization
+	instanceData->signingOperationsSinceContextRandomization = 0;
+	
+	// Return true
+	return true;
+}
+
+// Count signing operation
+void countSigningOperation(napi_env environment, InstanceData *instanceData) {
+
+	// Check if automatically randomizing the context is enabled and the interval has been reached
+	if(instanceData->contextRandomizationInterval && ++instanceData->signingOperationsSinceContextRandomization >= instanceData->contextRandomizationInterval) {
+	
+		// Randomize instance data's context and retry after the next signing operation if it fails
+		randomizeContext(environment, instanceData);
+	}
+}
+
+// Get instance memory usage
+tuple<size_t, size_t, size_t, size_t, size_t, size_t> getInstanceMemoryUsage(InstanceData *instanceData) {
+
+	// Get memory used by instance data's context and retired context
+	const size_t contextMemory = (instanceData->context ? contextMemoryUsage(instanceData->context) : 0) + (instanceData->retiredContext ? contextMemoryUsage(instanceData->retiredContext) : 0);
+	
+	// Get memory used by instance data's scratch space and helper scratch spaces
+	size_t scratchSpaceMemory = instanceData->scratchSpace ? scratchSpaceMemoryUsage(instanceData->scratchSpace) : 0;
+	{
+		lock_guard<mutex> lock(instanceData->helperScratchSpaces.lock);
+		scratchSpaceMemory += instanceData->helperScratchSpaces.memoryUsage;
+	}
+	
+	// Get memory used by instance data's generators
+	const size_t generatorsMemory = instanceData->generators ? generatorsMemoryUsage(instanceData->generators) : 0;
+	
+	// Get memory used by instance data's secure arena and secure overflow allocations
+	size_t secureArenaMemory = instanceData->secureArena ? SECURE_ARENA_SIZE : 0;
+	for(const SecureOverflowAllocation &secureOverflowAllocation : instanceData->secureOverflowAllocations) {
+	
+		// Add secure overflow allocation's size to the memory used
+		secureArenaMemory += secureOverflowAllocation.size;
+	}
+	
+	// Get memory used by instance data's proof cache
+	const size_t proofCacheMemory = verificationCacheMemoryUsage(&instanceData->proofCache);
+	
+	// Get memory used by instance data's signature cache
+	const size_t signatureCacheMemory = verificationCacheMemoryUsage(&instanceData->signatureCache);
+	
+	// Return memory usage
+	return {contextMemory, scratchSpaceMemory, generatorsMemory, secureArenaMemory, proofCacheMemory, signatureCacheMemory};
+}
+
+// Update external memory
+void updateExternalMemory(napi_env environment, InstanceData *instanceData) {
+
+	// Get instance data's total memory usage
+	const tuple<size_t, size_t, size_t, size_t, size_t, size_t> memoryUsage = getInstanceMemoryUsage(instanceData);
+	const int64_t total = get<0>(memoryUsage) + get<1>(memoryUsage) + get<2>(memoryUsage) + get<3>(memoryUsage) + get<4>(memoryUsage) + get<5>(memoryUsage);
+	
+	// Check if total changed since it was last reported
+	if(total != instanceData->externalMemory) {
+	
+		// Check if reporting the change to the garbage collector was successful
+		int64_t adjustedValue;
+		if(napi_adjust_external_memory(environment, total - instanceData->externalMemory, &adjustedValue) == napi_ok) {
+		
+			// Set instance data's external memory
+			instanceData->externalMemory = total;
+		}
+	}
+}
+
+// Get arguments
+template<size_t numberOfArguments> bool getArguments(napi_env environment, napi_callback_info arguments, array<napi_value, numberOfArguments> &argv, napi_value *thisArgument, size_t numberOfOptionalArguments) {
+
+	// Return if getting the number of arguments was successful and only optional arguments are missing which will be undefined
+	size_t argc = argv.size();
+	return napi_get_cb_info(environment, arguments, &argc, argv.data(), thisArgument, nullptr) == napi_ok && argc <= argv.size() && argc + numberOfOptionalArguments >= argv.size();
+}
+
 // Blind switch
 napi_value blindSwitch(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
-	InstanceData *instanceData = getInstanceData(environment);
+	InstanceData *instanceData = getInstanceData(environment, VERIFY_CAPABILITY);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 2;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 2> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting blind from arguments failed
@@ -583,27 +1739,43 @@ napi_value blindSwitch(napi_env environment, napi_callback_info arguments) {
 	if(!get<2>(blind)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting value from arguments failed
-	const tuple<string, bool> value = stringToCString(environment, argv[1]);
-	if(!get<1>(value)) {
+	array<char, MAX_64_BIT_INTEGER_STRING_LENGTH> value;
+	if(!stringToCString(environment, argv[1], value)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if allocating result failed
+	uint8_t *result = secureAllocate(instanceData, BLIND_SIZE);
+	if(!result) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if performing blind switch failed
-	vector<uint8_t> result(Secp256k1Zkp::blindSize(instanceData));
-	if(!Secp256k1Zkp::blindSwitch(instanceData, result.data(), get<0>(blind), get<1>(blind), get<0>(value).c_str())) {
+	if(!Secp256k1Zkp::blindSwitch(instanceData, result, get<0>(blind), get<1>(blind), value.data())) {
 	
+		// Free result
+		secureFree(instanceData, result);
+		
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
+	// Get result as a uint8 array
+	const napi_value uint8ArrayResult = bufferToUint8Array(environment, result, BLIND_SIZE);
+	
+	// Free result
+	secureFree(instanceData, result);
+	
 	// Return result as a uint8 array
-	return bufferToUint8Array(environment, result.data(), result.size());
+	return uint8ArrayResult;
 }
 
 // Blind sum
@@ -614,16 +1786,15 @@ napi_value blindSum(napi_env environment, napi_callback_info arguments) {
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if not enough arguments were provided
-	size_t argc = 2;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 2> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting number of positive blinds from arguments failed
@@ -632,7 +1803,7 @@ napi_value blindSum(napi_env environment, napi_callback_info arguments) {
 	if(napi_is_array(environment, argv[0], &isArray) != napi_ok || !isArray || napi_get_array_length(environment, argv[0], &numberOfPositiveBlinds) != napi_ok) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting number of negative blinds from arguments failed
@@ -640,93 +1811,82 @@ napi_value blindSum(napi_env environment, napi_callback_info arguments) {
 	if(napi_is_array(environment, argv[1], &isArray) != napi_ok || !isArray || napi_get_array_length(environment, argv[1], &numberOfNegativeBlinds) != napi_ok) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Initialize blinds and blinds sizes
-	vector<uint8_t> blinds;
+	// Initialize blind buffers and blinds sizes
+	vector<const uint8_t *> blindBuffers(numberOfPositiveBlinds + numberOfNegativeBlinds);
 	vector<size_t> blindsSizes(numberOfPositiveBlinds + numberOfNegativeBlinds);
+	size_t totalBlindsSize = 0;
 	
-	// Go through all positive blinds
-	for(uint32_t i = 0; i < numberOfPositiveBlinds; ++i) {
+	// Go through all positive and negative blinds
+	for(uint32_t i = 0; i < numberOfPositiveBlinds + numberOfNegativeBlinds; ++i) {
 	
 		// Check if getting blind failed
 		napi_value blind;
-		if(napi_get_element(environment, argv[0], i, &blind) != napi_ok) {
-		
-			// Clear blinds
-			memset(blinds.data(), 0, blinds.size());
+		if(napi_get_element(environment, argv[(i < numberOfPositiveBlinds) ? 0 : 1], (i < numberOfPositiveBlinds) ? i : i - numberOfPositiveBlinds, &blind) != napi_ok) {
 		
 			// Return operation failed
-			return OPERATION_FAILED;
+			return operationFailed(environment);
 		}
 		
 		// Check if getting blind as a buffer failed
 		const tuple<uint8_t *, size_t, bool> blindBuffer = uint8ArrayToBuffer(environment, blind);
 		if(!get<2>(blindBuffer)) {
 		
-			// Clear blinds
-			memset(blinds.data(), 0, blinds.size());
-		
 			// Return operation failed
-			return OPERATION_FAILED;
+			return operationFailed(environment);
 		}
 		
-		// Append blind buffer to blinds
-		blinds.insert(blinds.cend(), get<0>(blindBuffer), get<0>(blindBuffer) + get<1>(blindBuffer));
-		
-		// Append blind's size to blinds sizes
+		// Set blind buffer and blind's size
+		blindBuffers[i] = get<0>(blindBuffer);
 		blindsSizes[i] = get<1>(blindBuffer);
+		
+		// Update total blinds size
+		totalBlindsSize += get<1>(blindBuffer);
 	}
 	
-	// Go through all negative blinds
-	for(uint32_t i = 0; i < numberOfNegativeBlinds; ++i) {
+	// Check if allocating blinds and result failed
+	uint8_t *blinds = secureAllocate(instanceData, totalBlindsSize);
+	uint8_t *result = secureAllocate(instanceData, BLIND_SIZE);
+	if(!blinds || !result) {
 	
-		// Check if getting blind failed
-		napi_value blind;
-		if(napi_get_element(environment, argv[1], i, &blind) != napi_ok) {
-		
-			// Clear blinds
-			memset(blinds.data(), 0, blinds.size());
+		// Check if blinds were allocated
+		if(blinds) {
 		
-			// Return operation failed
-			return OPERATION_FAILED;
-		}
-		
-		// Check if getting blind as a buffer failed
-		const tuple<uint8_t *, size_t, bool> blindBuffer = uint8ArrayToBuffer(environment, blind);
-		if(!get<2>(blindBuffer)) {
-		
-			// Clear blinds
-			memset(blinds.data(), 0, blinds.size());
-		
-			// Return operation failed
-			return OPERATION_FAILED;
+			// Free blinds
+			secureFree(instanceData, blinds);
 		}
 		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Go through all blinds
+	for(size_t i = 0, offset = 0; i < blindBuffers.size(); offset += blindsSizes[i++]) {
+	
 		// Append blind buffer to blinds
-		blinds.insert(blinds.cend(), get<0>(blindBuffer), get<0>(blindBuffer) + get<1>(blindBuffer));
-		
-		// Append blind's size to blinds sizes
-		blindsSizes[i + numberOfPositiveBlinds] = get<1>(blindBuffer);
+		memcpy(&blinds[offset], blindBuffers[i], blindsSizes[i]);
 	}
 	
 	// Check if performing blind sum failed
-	vector<uint8_t> result(Secp256k1Zkp::blindSize(instanceData));
-	if(!Secp256k1Zkp::blindSum(instanceData, result.data(), blinds.data(), blindsSizes.data(), numberOfPositiveBlinds + numberOfNegativeBlinds, numberOfPositiveBlinds)) {
-	
-		// Clear blinds
-		memset(blinds.data(), 0, blinds.size());
+	if(!Secp256k1Zkp::blindSum(instanceData, result, blinds, blindsSizes.data(), numberOfPositiveBlinds + numberOfNegativeBlinds, numberOfPositiveBlinds)) {
 	
+		// Free blinds and result
+		secureFree(instanceData, blinds);
+		
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Clear blinds
-	memset(blinds.data(), 0, blinds.size());
+	// Get result as a uint8 array
+	const napi_value uint8ArrayResult = bufferToUint8Array(environment, result, BLIND_SIZE);
+	
+	// Free blinds and result
+	secureFree(instanceData, blinds);
 	
 	// Return result as a uint8 array
-	return bufferToUint8Array(environment, result.data(), result.size());
+	return uint8ArrayResult;
 }
 
 // Is valid secret key
@@ -741,9 +1901,8 @@ napi_value isValidSecretKey(napi_env environment, napi_callback_info arguments)
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 1;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return false as a bool
 		return cBoolToBool(environment, false);
@@ -780,9 +1939,8 @@ napi_value isValidPublicKey(napi_env environment, napi_callback_info arguments)
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 1;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return false as a bool
 		return cBoolToBool(environment, false);
@@ -819,9 +1977,8 @@ napi_value isValidCommit(napi_env environment, napi_callback_info arguments) {
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 1;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return false as a bool
 		return cBoolToBool(environment, false);
@@ -846,6 +2003,87 @@ napi_value isValidCommit(napi_env environment, napi_callback_info arguments) {
 	return cBoolToBool(environment, true);
 }
 
+// Are valid secret keys
+napi_value areValidSecretKeys(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment);
+	if(!instanceData) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return performing batch format check on the secret keys
+	const secp256k1_context *context = instanceData->context;
+	return performBatchFormatCheck(environment, arguments, SECRET_KEY_SIZE, [context](const uint8_t *secretKeys, size_t numberOfSecretKeys, bool *results) {
+	
+		// Go through all secret keys
+		for(size_t i = 0; i < numberOfSecretKeys; ++i) {
+		
+			// Set secret key's result to if it's valid
+			results[i] = secp256k1_ec_seckey_verify(context, &secretKeys[i * SECRET_KEY_SIZE]);
+		}
+	});
+}
+
+// Are valid public keys
+napi_value areValidPublicKeys(napi_env environment, napi_callback_info arguments) {
+
+	// Return performing batch format check on the public keys
+	return performBatchFormatCheck(environment, arguments, PUBLIC_KEY_SIZE, [](const uint8_t *publicKeys, size_t numberOfPublicKeys, bool *results) {
+	
+		// Check if public keys are valid compressed public keys together
+		areValidCompressedPoints(publicKeys, numberOfPublicKeys, PUBLIC_KEY_EVEN_PREFIX, results);
+	});
+}
+
+// Are valid commits
+napi_value areValidCommits(napi_env environment, napi_callback_info arguments) {
+
+	// Return performing batch format check on the commits
+	return performBatchFormatCheck(environment, arguments, COMMIT_SIZE, [](const uint8_t *commits, size_t numberOfCommits, bool *results) {
+	
+		// Check if commits are valid commits together
+		areValidCompressedPoints(commits, numberOfCommits, COMMIT_EVEN_PREFIX, results);
+	});
+}
+
+// SHA-256 multiple
+napi_value sha256Multiple(napi_env environment, napi_callback_info arguments) {
+
+	// Check if not enough arguments were provided
+	array<napi_value, 2> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting message size from arguments failed or it's invalid
+	uint32_t messageSize;
+	if(napi_get_value_uint32(environment, argv[1], &messageSize) != napi_ok || !messageSize) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting messages from arguments failed
+	const tuple<uint8_t *, size_t, bool> messages = packedUint8ArrayToBuffer(environment, argv[0], messageSize);
+	if(!get<2>(messages)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Hash the messages together using the same multi-buffer hashing as rewind scans
+	vector<uint8_t> hashes(get<1>(messages) * SHA256_HASH_SIZE);
+	sha256Multiple(hashes.data(), get<0>(messages), messageSize, get<1>(messages));
+	
+	// Return hashes as a uint8 array
+	return bufferToUint8Array(environment, hashes.data(), hashes.size());
+}
+
 // Is valid single-signer signature
 napi_value isValidSingleSignerSignature(napi_env environment, napi_callback_info arguments) {
 
@@ -858,9 +2096,8 @@ napi_value isValidSingleSignerSignature(napi_env environment, napi_callback_info
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 1;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return false as a bool
 		return cBoolToBool(environment, false);
@@ -889,20 +2126,19 @@ napi_value isValidSingleSignerSignature(napi_env environment, napi_callback_info
 napi_value createBulletproof(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
-	InstanceData *instanceData = getInstanceData(environment);
+	InstanceData *instanceData = getInstanceData(environment, VERIFY_CAPABILITY | SCRATCH_SPACE_CAPABILITY | GENERATORS_CAPABILITY);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 6;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 6> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting blind from arguments failed
@@ -910,15 +2146,15 @@ napi_value createBulletproof(napi_env environment, napi_callback_info arguments)
 	if(!get<2>(blind)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting value from arguments failed
-	const tuple<string, bool> value = stringToCString(environment, argv[1]);
-	if(!get<1>(value)) {
+	array<char, MAX_64_BIT_INTEGER_STRING_LENGTH> value;
+	if(!stringToCString(environment, argv[1], value)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting nonce from arguments failed
@@ -926,7 +2162,7 @@ napi_value createBulletproof(napi_env environment, napi_callback_info arguments)
 	if(!get<2>(nonce)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting private nonce from arguments failed
@@ -934,7 +2170,7 @@ napi_value createBulletproof(napi_env environment, napi_callback_info arguments)
 	if(!get<2>(privateNonce)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting extra commit from arguments failed
@@ -942,7 +2178,7 @@ napi_value createBulletproof(napi_env environment, napi_callback_info arguments)
 	if(!get<2>(extraCommit)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting message from arguments failed
@@ -950,40 +2186,63 @@ napi_value createBulletproof(napi_env environment, napi_callback_info arguments)
 	if(!get<2>(message)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
+	}
+	
+	// Check if creating array buffer for the proof failed
+	uint8_t *proof;
+	napi_value arrayBuffer;
+	if(napi_create_arraybuffer(environment, BULLETPROOF_PROOF_MAXIMUM_SIZE, reinterpret_cast<void **>(&proof), &arrayBuffer) != napi_ok) {
+	
+		// Return operation failed
+		return operationFailed(environment);
 	}
 	
-	// Check if creating bulletproof failed
-	vector<uint8_t> proof(Secp256k1Zkp::bulletproofProofSize(instanceData));
+	// Check if creating bulletproof directly in the array buffer failed
 	char proofSize[MAX_64_BIT_INTEGER_STRING_LENGTH];
-	if(!Secp256k1Zkp::createBulletproof(instanceData, proof.data(), proofSize, get<0>(blind), get<1>(blind), get<0>(value).c_str(), get<0>(nonce), get<1>(nonce), get<0>(privateNonce), get<1>(privateNonce), get<0>(extraCommit), get<1>(extraCommit), get<0>(message), get<1>(message))) {
+	if(!Secp256k1Zkp::createBulletproof(instanceData, proof, proofSize, get<0>(blind), get<1>(blind), value.data(), get<0>(nonce), get<1>(nonce), get<0>(privateNonce), get<1>(privateNonce), get<0>(extraCommit), get<1>(extraCommit), get<0>(message), get<1>(message))) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if proof's size is invalid
+	const size_t size = strtoull(proofSize, nullptr, 10);
+	if(size > BULLETPROOF_PROOF_MAXIMUM_SIZE) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if creating uint8 array view of the proof without copying it failed
+	napi_value uint8Array;
+	if(napi_create_typedarray(environment, napi_uint8_array, size, arrayBuffer, 0, &uint8Array) != napi_ok) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Return proof as a uint8 array
-	return bufferToUint8Array(environment, proof.data(), strtoull(proofSize, nullptr, 10));
+	// Return uint8 array
+	return uint8Array;
 }
 
 // Create bulletproof blindless
 napi_value createBulletproofBlindless(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
-	InstanceData *instanceData = getInstanceData(environment);
+	InstanceData *instanceData = getInstanceData(environment, VERIFY_CAPABILITY | SCRATCH_SPACE_CAPABILITY | GENERATORS_CAPABILITY);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 8;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 8> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting tau x from arguments failed
@@ -991,7 +2250,7 @@ napi_value createBulletproofBlindless(napi_env environment, napi_callback_info a
 	if(!get<2>(tauX)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting t one from arguments failed
@@ -999,7 +2258,7 @@ napi_value createBulletproofBlindless(napi_env environment, napi_callback_info a
 	if(!get<2>(tOne)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting t two from arguments failed
@@ -1007,7 +2266,7 @@ napi_value createBulletproofBlindless(napi_env environment, napi_callback_info a
 	if(!get<2>(tTwo)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting commit from arguments failed
@@ -1015,15 +2274,15 @@ napi_value createBulletproofBlindless(napi_env environment, napi_callback_info a
 	if(!get<2>(commit)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting value from arguments failed
-	const tuple<string, bool> value = stringToCString(environment, argv[4]);
-	if(!get<1>(value)) {
+	array<char, MAX_64_BIT_INTEGER_STRING_LENGTH> value;
+	if(!stringToCString(environment, argv[4], value)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting nonce from arguments failed
@@ -1031,7 +2290,7 @@ napi_value createBulletproofBlindless(napi_env environment, napi_callback_info a
 	if(!get<2>(nonce)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting extra commit from arguments failed
@@ -1039,7 +2298,7 @@ napi_value createBulletproofBlindless(napi_env environment, napi_callback_info a
 	if(!get<2>(extraCommit)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting message from arguments failed
@@ -1047,40 +2306,63 @@ napi_value createBulletproofBlindless(napi_env environment, napi_callback_info a
 	if(!get<2>(message)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
+	}
+	
+	// Check if creating array buffer for the proof failed
+	uint8_t *proof;
+	napi_value arrayBuffer;
+	if(napi_create_arraybuffer(environment, BULLETPROOF_PROOF_MAXIMUM_SIZE, reinterpret_cast<void **>(&proof), &arrayBuffer) != napi_ok) {
+	
+		// Return operation failed
+		return operationFailed(environment);
 	}
 	
-	// Check if creating bulletproof blindless failed
-	vector<uint8_t> proof(Secp256k1Zkp::bulletproofProofSize(instanceData));
+	// Check if creating bulletproof blindless directly in the array buffer failed
 	char proofSize[MAX_64_BIT_INTEGER_STRING_LENGTH];
-	if(!Secp256k1Zkp::createBulletproofBlindless(instanceData, proof.data(), proofSize, get<0>(tauX), get<1>(tauX), get<0>(tOne), get<1>(tOne), get<0>(tTwo), get<1>(tTwo), get<0>(commit), get<1>(commit), get<0>(value).c_str(), get<0>(nonce), get<1>(nonce), get<0>(extraCommit), get<1>(extraCommit), get<0>(message), get<1>(message))) {
+	if(!Secp256k1Zkp::createBulletproofBlindless(instanceData, proof, proofSize, get<0>(tauX), get<1>(tauX), get<0>(tOne), get<1>(tOne), get<0>(tTwo), get<1>(tTwo), get<0>(commit), get<1>(commit), value.data(), get<0>(nonce), get<1>(nonce), get<0>(extraCommit), get<1>(extraCommit), get<0>(message), get<1>(message))) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if proof's size is invalid
+	const size_t size = strtoull(proofSize, nullptr, 10);
+	if(size > BULLETPROOF_PROOF_MAXIMUM_SIZE) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Return proof as a uint8 array
-	return bufferToUint8Array(environment, proof.data(), strtoull(proofSize, nullptr, 10));
+	// Check if creating uint8 array view of the proof without copying it failed
+	napi_value uint8Array;
+	if(napi_create_typedarray(environment, napi_uint8_array, size, arrayBuffer, 0, &uint8Array) != napi_ok) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return uint8 array
+	return uint8Array;
 }
 
 // Rewind bulletproof
 napi_value rewindBulletproof(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
-	InstanceData *instanceData = getInstanceData(environment);
+	InstanceData *instanceData = getInstanceData(environment, VERIFY_CAPABILITY);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 3;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 3> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting proof from arguments failed
@@ -1088,7 +2370,7 @@ napi_value rewindBulletproof(napi_env environment, napi_callback_info arguments)
 	if(!get<2>(proof)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting commit from arguments failed
@@ -1096,7 +2378,7 @@ napi_value rewindBulletproof(napi_env environment, napi_callback_info arguments)
 	if(!get<2>(commit)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting nonce from arguments failed
@@ -1104,60 +2386,68 @@ napi_value rewindBulletproof(napi_env environment, napi_callback_info arguments)
 	if(!get<2>(nonce)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if performing rewind bulletproof failed
-	char value[MAX_64_BIT_INTEGER_STRING_LENGTH];
-	vector<uint8_t> blind(Secp256k1Zkp::blindSize(instanceData));
-	vector<uint8_t> message(Secp256k1Zkp::bulletproofMessageSize(instanceData));
-	if(!Secp256k1Zkp::rewindBulletproof(instanceData, value, blind.data(), message.data(), get<0>(proof), get<1>(proof), get<0>(commit), get<1>(commit), get<0>(nonce), get<1>(nonce))) {
+	// Return performing rewind bulletproof
+	return performRewindBulletproof(environment, instanceData, [instanceData, &proof, &commit, &nonce](char *value, uint8_t *blind, uint8_t *message) -> bool {
 	
-		// Return operation failed
-		return OPERATION_FAILED;
+		// Return performing rewind bulletproof with the nonce
+		return Secp256k1Zkp::rewindBulletproof(instanceData, value, blind, message, get<0>(proof), get<1>(proof), get<0>(commit), get<1>(commit), get<0>(nonce), get<1>(nonce));
+	});
+}
+
+// Can rewind bulletproof
+napi_value canRewindBulletproof(napi_env environment, napi_callback_info arguments) {
+
+	// Check if not enough arguments were provided
+	array<napi_value, 3> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
 	}
 	
-	// Check if creating result failed
-	napi_value result;
-	if(napi_create_object(environment, &result) != napi_ok) {
+	// Check if getting proof from arguments failed
+	const tuple<uint8_t *, size_t, bool> proof = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(proof)) {
 	
-		// Return operation failed
-		return OPERATION_FAILED;
+		// Return false as a bool
+		return cBoolToBool(environment, false);
 	}
 	
-	// Check if adding value to result failed
-	napi_value temp;
-	if(napi_create_string_utf8(environment, value, NAPI_AUTO_LENGTH, &temp) != napi_ok || napi_set_named_property(environment, result, "Value", temp) != napi_ok) {
+	// Check if getting commit from arguments failed
+	const tuple<uint8_t *, size_t, bool> commit = uint8ArrayToBuffer(environment, argv[1]);
+	if(!get<2>(commit)) {
 	
-		// Return operation failed
-		return OPERATION_FAILED;
+		// Return false as a bool
+		return cBoolToBool(environment, false);
 	}
 	
-	// Check if adding blind to result failed
-	const napi_value uint8ArrayBlind = bufferToUint8Array(environment, blind.data(), blind.size());
-	if(isNull(environment, uint8ArrayBlind) || napi_set_named_property(environment, result, "Blind", uint8ArrayBlind) != napi_ok) {
+	// Check if getting nonce from arguments failed
+	const tuple<uint8_t *, size_t, bool> nonce = uint8ArrayToBuffer(environment, argv[2]);
+	if(!get<2>(nonce)) {
 	
-		// Return operation failed
-		return OPERATION_FAILED;
+		// Return false as a bool
+		return cBoolToBool(environment, false);
 	}
 	
-	// Check if adding message to result failed
-	const napi_value uint8ArrayMessage = bufferToUint8Array(environment, message.data(), message.size());
-	if(isNull(environment, uint8ArrayMessage) || napi_set_named_property(environment, result, "Message", uint8ArrayMessage) != napi_ok) {
+	// Check if bulletproof's encoded value and message can't be recovered with the nonce without parsing the commit or reconstructing it
+	if(!bulletproofRewindPrecheck(get<0>(proof), get<1>(proof), get<0>(commit), get<1>(commit), get<0>(nonce), get<1>(nonce))) {
 	
-		// Return operation failed
-		return OPERATION_FAILED;
+		// Return false as a bool
+		return cBoolToBool(environment, false);
 	}
 	
-	// Return result
-	return result;
+	// Return true as a bool
+	return cBoolToBool(environment, true);
 }
 
 // Verify bulletproof
 napi_value verifyBulletproof(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
-	InstanceData *instanceData = getInstanceData(environment);
+	InstanceData *instanceData = getInstanceData(environment, VERIFY_CAPABILITY | SCRATCH_SPACE_CAPABILITY | GENERATORS_CAPABILITY);
 	if(!instanceData) {
 	
 		// Return false as a bool
@@ -1165,9 +2455,8 @@ napi_value verifyBulletproof(napi_env environment, napi_callback_info arguments)
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 3;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 3> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return false as a bool
 		return cBoolToBool(environment, false);
@@ -1197,6 +2486,14 @@ napi_value verifyBulletproof(napi_env environment, napi_callback_info arguments)
 		return cBoolToBool(environment, false);
 	}
 	
+	// Check if bulletproof was already verified
+	string proofCacheKey;
+	if(verificationCacheContains(&instanceData->proofCache, proofCacheKey, {{get<0>(proof), get<1>(proof)}, {get<0>(commit), get<1>(commit)}, {get<0>(extraCommit), get<1>(extraCommit)}})) {
+	
+		// Return true as a bool
+		return cBoolToBool(environment, true);
+	}
+	
 	// Check if bulletproof isn't verified
 	if(!Secp256k1Zkp::verifyBulletproof(instanceData, get<0>(proof), get<1>(proof), get<0>(commit), get<1>(commit), get<0>(extraCommit), get<1>(extraCommit))) {
 	
@@ -1204,244 +2501,523 @@ napi_value verifyBulletproof(napi_env environment, napi_callback_info arguments)
 		return cBoolToBool(environment, false);
 	}
 	
+	// Check if bulletproof was added to the proof cache as a new entry
+	if(verificationCacheAdd(&instanceData->proofCache, proofCacheKey)) {
+	
+		// Update external memory
+		updateExternalMemory(environment, instanceData);
+	}
+	
 	// Return true as a bool
 	return cBoolToBool(environment, true);
 }
 
-// Public key from secret key
-napi_value publicKeyFromSecretKey(napi_env environment, napi_callback_info arguments) {
+// Create rewind context
+napi_value createRewindContext(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
 	InstanceData *instanceData = getInstanceData(environment);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
-
+	
 	// Check if not enough arguments were provided
-	size_t argc = 1;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting secret key from arguments failed
-	const tuple<uint8_t *, size_t, bool> secretKey = uint8ArrayToBuffer(environment, argv[0]);
-	if(!get<2>(secretKey)) {
+	// Check if getting nonce from arguments failed
+	const tuple<uint8_t *, size_t, bool> nonce = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(nonce)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting public key from secret key failed
-	vector<uint8_t> publicKey(Secp256k1Zkp::publicKeySize(instanceData));
-	if(!Secp256k1Zkp::publicKeyFromSecretKey(instanceData, publicKey.data(), get<0>(secretKey), get<1>(secretKey))) {
+	// Check if creating rewind context failed
+	RewindContext *rewindContext = new(nothrow) RewindContext;
+	if(!rewindContext) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Return public key as a uint8 array
-	return bufferToUint8Array(environment, publicKey.data(), publicKey.size());
-}
-
-// Public key from data
-napi_value publicKeyFromData(napi_env environment, napi_callback_info arguments) {
-
-	// Check if getting instance data failed
-	InstanceData *instanceData = getInstanceData(environment);
-	if(!instanceData) {
+	// Check if creating rewind context's cache from the nonce failed
+	rewindContext->cache = bulletproofRewindCacheCreate(get<0>(nonce), get<1>(nonce));
+	if(!rewindContext->cache) {
 	
+		// Free memory
+		delete rewindContext;
+		
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
-
-	// Check if not enough arguments were provided
-	size_t argc = 1;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
 	
+	// Set rewind context's nonce
+	rewindContext->nonce.assign(get<0>(nonce), get<0>(nonce) + get<1>(nonce));
+	
+	// Check if creating rewind context object failed
+	napi_value constructor;
+	napi_value result;
+	if(napi_get_reference_value(environment, instanceData->rewindContextConstructor, &constructor) != napi_ok || napi_new_instance(environment, constructor, 0, nullptr, &result) != napi_ok) {
+	
+		// Destroy rewind context's cache
+		bulletproofRewindCacheDestroy(rewindContext->cache);
+		
+		// Clear rewind context's nonce
+		secureClear(rewindContext->nonce.data(), rewindContext->nonce.size());
+		
+		// Free memory
+		delete rewindContext;
+		
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting data from arguments failed
-	const tuple<uint8_t *, size_t, bool> data = uint8ArrayToBuffer(environment, argv[0]);
-	if(!get<2>(data)) {
+	// Check if associating rewind context with the object failed
+	if(napi_wrap(environment, result, rewindContext, [](napi_env environment, void *finalizeData, void *finalizeHint) {
 	
+		// Get rewind context
+		RewindContext *rewindContext = reinterpret_cast<RewindContext *>(finalizeData);
+		
+		// Destroy rewind context's cache
+		bulletproofRewindCacheDestroy(rewindContext->cache);
+		
+		// Clear rewind context's nonce
+		secureClear(rewindContext->nonce.data(), rewindContext->nonce.size());
+		
+		// Free memory
+		delete rewindContext;
+		
+	}, nullptr, nullptr) != napi_ok) {
+	
+		// Destroy rewind context's cache
+		bulletproofRewindCacheDestroy(rewindContext->cache);
+		
+		// Clear rewind context's nonce
+		secureClear(rewindContext->nonce.data(), rewindContext->nonce.size());
+		
+		// Free memory
+		delete rewindContext;
+		
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting public key from data failed
-	vector<uint8_t> publicKey(Secp256k1Zkp::publicKeySize(instanceData));
-	if(!Secp256k1Zkp::publicKeyFromData(instanceData, publicKey.data(), get<0>(data), get<1>(data))) {
+	// Check if tagging the object as a rewind context failed
+	if(napi_type_tag_object(environment, result, &REWIND_CONTEXT_TYPE_TAG) != napi_ok) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Return public key as a uint8 array
-	return bufferToUint8Array(environment, publicKey.data(), publicKey.size());
+	// Return result
+	return result;
 }
 
-// Uncompress public key
-napi_value uncompressPublicKey(napi_env environment, napi_callback_info arguments) {
+// Rewind context can rewind
+napi_value rewindContextCanRewind(napi_env environment, napi_callback_info arguments) {
 
-	// Check if getting instance data failed
-	InstanceData *instanceData = getInstanceData(environment);
-	if(!instanceData) {
+	// Check if not enough arguments were provided
+	array<napi_value, 2> argv;
+	napi_value thisArgument;
+	if(!getArguments(environment, arguments, argv, &thisArgument)) {
 	
-		// Return operation failed
-		return OPERATION_FAILED;
+		// Return false as a bool
+		return cBoolToBool(environment, false);
 	}
-
-	// Check if not enough arguments were provided
-	size_t argc = 1;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
 	
-		// Return operation failed
-		return OPERATION_FAILED;
+	// Check if getting rewind context failed
+	const tuple<RewindContext *, bool> rewindContext = getRewindContext(environment, thisArgument);
+	if(!get<1>(rewindContext)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
 	}
 	
-	// Check if getting public key from arguments failed
-	const tuple<uint8_t *, size_t, bool> publicKey = uint8ArrayToBuffer(environment, argv[0]);
-	if(!get<2>(publicKey)) {
+	// Check if getting proof from arguments failed
+	const tuple<uint8_t *, size_t, bool> proof = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(proof)) {
 	
-		// Return operation failed
-		return OPERATION_FAILED;
+		// Return false as a bool
+		return cBoolToBool(environment, false);
 	}
 	
-	// Check if uncompressing the public key failed
-	vector<uint8_t> uncompressedPublicKey(Secp256k1Zkp::uncompressedPublicKeySize(instanceData));
-	if(!Secp256k1Zkp::uncompressPublicKey(instanceData, uncompressedPublicKey.data(), get<0>(publicKey), get<1>(publicKey))) {
+	// Check if getting commit from arguments failed
+	const tuple<uint8_t *, size_t, bool> commit = uint8ArrayToBuffer(environment, argv[1]);
+	if(!get<2>(commit)) {
 	
-		// Return operation failed
-		return OPERATION_FAILED;
+		// Return false as a bool
+		return cBoolToBool(environment, false);
 	}
 	
-	// Return uncompressed public key as a uint8 array
-	return bufferToUint8Array(environment, uncompressedPublicKey.data(), uncompressedPublicKey.size());
+	// Check if bulletproof's encoded value and message can't be recovered with the rewind context's cache
+	if(!bulletproofRewindCachePrecheck(get<0>(rewindContext)->cache, get<0>(proof), get<1>(proof), get<0>(commit), get<1>(commit))) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Return true as a bool
+	return cBoolToBool(environment, true);
 }
 
-// Secret key tweak add
-napi_value secretKeyTweakAdd(napi_env environment, napi_callback_info arguments) {
+// Rewind context rewind
+napi_value rewindContextRewind(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
 	InstanceData *instanceData = getInstanceData(environment);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
-
+	
 	// Check if not enough arguments were provided
-	size_t argc = 2;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 2> argv;
+	napi_value thisArgument;
+	if(!getArguments(environment, arguments, argv, &thisArgument)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting secret key from arguments failed
-	const tuple<uint8_t *, size_t, bool> secretKey = uint8ArrayToBuffer(environment, argv[0]);
-	if(!get<2>(secretKey)) {
+	// Check if getting rewind context failed
+	const tuple<RewindContext *, bool> rewindContext = getRewindContext(environment, thisArgument);
+	if(!get<1>(rewindContext)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting tweak from arguments failed
-	const tuple<uint8_t *, size_t, bool> tweak = uint8ArrayToBuffer(environment, argv[1]);
-	if(!get<2>(tweak)) {
+	// Check if getting proof from arguments failed
+	const tuple<uint8_t *, size_t, bool> proof = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(proof)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if performing secret key tweak add failed
-	vector<uint8_t> result(Secp256k1Zkp::secretKeySize(instanceData));
-	if(!Secp256k1Zkp::secretKeyTweakAdd(instanceData, result.data(), get<0>(secretKey), get<1>(secretKey), get<0>(tweak), get<1>(tweak))) {
+	// Check if getting commit from arguments failed
+	const tuple<uint8_t *, size_t, bool> commit = uint8ArrayToBuffer(environment, argv[1]);
+	if(!get<2>(commit)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Return result as a uint8 array
-	return bufferToUint8Array(environment, result.data(), result.size());
+	// Return performing rewind bulletproof with the rewind context's cache
+	const BulletproofRewindCache *cache = get<0>(rewindContext)->cache;
+	return performRewindBulletproof(environment, instanceData, [instanceData, cache, &proof, &commit](char *value, uint8_t *blind, uint8_t *message) -> bool {
+	
+		// Return performing rewind bulletproof with the cache
+		return rewindBulletproofWithCache(instanceData->context, cache, value, blind, message, get<0>(proof), get<1>(proof), get<0>(commit), get<1>(commit));
+	});
 }
 
-// Public key tweak add
-napi_value publicKeyTweakAdd(napi_env environment, napi_callback_info arguments) {
+// Rewind context scan
+napi_value rewindContextScan(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
 	InstanceData *instanceData = getInstanceData(environment);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
-
+	
 	// Check if not enough arguments were provided
-	size_t argc = 2;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 4> argv;
+	napi_value thisArgument;
+	if(!getArguments(environment, arguments, argv, &thisArgument, 1)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting public key from arguments failed
-	const tuple<uint8_t *, size_t, bool> publicKey = uint8ArrayToBuffer(environment, argv[0]);
-	if(!get<2>(publicKey)) {
+	// Check if getting rewind context failed
+	const tuple<RewindContext *, bool> rewindContext = getRewindContext(environment, thisArgument);
+	if(!get<1>(rewindContext)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting tweak from arguments failed
-	const tuple<uint8_t *, size_t, bool> tweak = uint8ArrayToBuffer(environment, argv[1]);
-	if(!get<2>(tweak)) {
+	// Check if getting number of proofs from arguments failed
+	bool isArray;
+	uint32_t numberOfProofs;
+	if(napi_is_array(environment, argv[0], &isArray) != napi_ok || !isArray || napi_get_array_length(environment, argv[0], &numberOfProofs) != napi_ok) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if performing public key tweak add failed
-	vector<uint8_t> result(Secp256k1Zkp::publicKeySize(instanceData));
-	if(!Secp256k1Zkp::publicKeyTweakAdd(instanceData, result.data(), get<0>(publicKey), get<1>(publicKey), get<0>(tweak), get<1>(tweak))) {
+	// Check if getting commits from arguments failed or there's not one for each proof
+	const tuple<uint8_t *, size_t, bool> commits = packedUint8ArrayToBuffer(environment, argv[1], COMMIT_SIZE);
+	if(!get<2>(commits) || get<1>(commits) != numberOfProofs) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Return result as a uint8 array
-	return bufferToUint8Array(environment, result.data(), result.size());
+	// Check if creating task failed
+	shared_ptr<RewindScanTask> task(new(nothrow) RewindScanTask);
+	if(!task) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Set task's commits and nonce
+	task->commits.assign(get<0>(commits), get<0>(commits) + get<1>(commits) * COMMIT_SIZE);
+	task->nonce = get<0>(rewindContext)->nonce;
+	task->result = false;
+	
+	// Go through all proofs
+	task->proofs.resize(numberOfProofs);
+	for(uint32_t i = 0; i < numberOfProofs; ++i) {
+	
+		// Check if getting proof failed
+		napi_value proof;
+		if(napi_get_element(environment, argv[0], i, &proof) != napi_ok) {
+		
+			// Clear task's nonce
+			secureClear(task->nonce.data(), task->nonce.size());
+			
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Check if getting proof as a buffer failed
+		const tuple<uint8_t *, size_t, bool> proofBuffer = uint8ArrayToBuffer(environment, proof);
+		if(!get<2>(proofBuffer)) {
+		
+			// Clear task's nonce
+			secureClear(task->nonce.data(), task->nonce.size());
+			
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Set task's proof to the proof buffer
+		task->proofs[i].assign(get<0>(proofBuffer), get<0>(proofBuffer) + get<1>(proofBuffer));
+	}
+	
+	// Check if getting abort signal from arguments failed
+	if(!getAbortSignal(environment, argv[3], task->abortSignal)) {
+	
+		// Clear task's nonce
+		secureClear(task->nonce.data(), task->nonce.size());
+		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return queueing streaming task
+	const secp256k1_context *context = instanceData->context;
+	return queueStreamingAsyncTask(environment, "rewindContextScan", argv[2], BULK_PRIORITY, task->abortSignal.aborted, [context, task](napi_threadsafe_function callback) {
+	
+		// Check if creating a cache for the task's nonce failed since the rewind context could be garbage collected while scanning
+		BulletproofRewindCache *cache = bulletproofRewindCacheCreate(task->nonce.data(), task->nonce.size());
+		if(!cache) {
+		
+			// Clear task's nonce
+			secureClear(task->nonce.data(), task->nonce.size());
+			
+			// Return
+			return;
+		}
+		
+		// Go through all proofs
+		const uint32_t numberOfProofs = task->proofs.size();
+		bool streamFailed = false;
+		array<bool, REWIND_SCAN_PRECHECKS_PER_BATCH> prechecks;
+		for(uint32_t i = 0; i < numberOfProofs && !streamFailed && !*task->abortSignal.aborted; ++i) {
+		
+			// Check if proof is the first in a precheck batch
+			if(i % REWIND_SCAN_PRECHECKS_PER_BATCH == 0) {
+			
+				// Go through all proofs in the precheck batch
+				const uint32_t batchSize = min(numberOfProofs - i, REWIND_SCAN_PRECHECKS_PER_BATCH);
+				array<const uint8_t *, REWIND_SCAN_PRECHECKS_PER_BATCH> batchProofs;
+				array<size_t, REWIND_SCAN_PRECHECKS_PER_BATCH> batchProofSizes;
+				array<const uint8_t *, REWIND_SCAN_PRECHECKS_PER_BATCH> batchCommits;
+				array<size_t, REWIND_SCAN_PRECHECKS_PER_BATCH> batchCommitSizes;
+				for(uint32_t j = 0; j < batchSize; ++j) {
+				
+					// Add proof and commit to the precheck batch
+					batchProofs[j] = task->proofs[i + j].data();
+					batchProofSizes[j] = task->proofs[i + j].size();
+					batchCommits[j] = &task->commits[(i + j) * COMMIT_SIZE];
+					batchCommitSizes[j] = COMMIT_SIZE;
+				}
+				
+				// Check if the precheck batch's proofs' encoded values and messages can be recovered with the cache while hashing their challenges together
+				bulletproofRewindCachePrecheckMultiple(cache, batchProofs.data(), batchProofSizes.data(), batchCommits.data(), batchCommitSizes.data(), batchSize, prechecks.data());
+			}
+			
+			// Get proof and commit
+			const vector<uint8_t> &proof = task->proofs[i];
+			const uint8_t *commit = &task->commits[i * COMMIT_SIZE];
+			
+			// Check if proof's encoded value and message can be recovered with the cache
+			if(prechecks[i % REWIND_SCAN_PRECHECKS_PER_BATCH]) {
+			
+				// Check if creating result failed
+				shared_ptr<RewindScanResult> result(new(nothrow) RewindScanResult);
+				if(!result) {
+				
+					// Set stream failed
+					streamFailed = true;
+					
+					// Break
+					break;
+				}
+				
+				// Set result's index, value, blind, and message
+				result->index = i;
+				result->value.resize(MAX_64_BIT_INTEGER_STRING_LENGTH);
+				result->blind.resize(BLIND_SIZE);
+				result->message.resize(BULLETPROOF_MESSAGE_SIZE);
+				
+				// Check if performing rewind bulletproof with the cache was successful
+				if(rewindBulletproofWithCache(context, cache, result->value.data(), result->blind.data(), result->message.data(), proof.data(), proof.size(), commit, COMMIT_SIZE)) {
+				
+					// Check if streaming the result failed
+					const uint32_t processed = i + 1;
+					if(!streamEvent(callback, task->abortSignal.aborted.get(), [processed, result](napi_env environment, napi_value callback) {
+					
+						// Check if environment exists
+						if(environment) {
+						
+							// Check if creating result object was successful
+							napi_value resultObject;
+							if(napi_create_object(environment, &resultObject) == napi_ok) {
+							
+								// Check if adding index, value, blind, and message to the result object was successful
+								napi_value index;
+								napi_value value;
+								const napi_value blind = bufferToUint8Array(environment, result->blind.data(), result->blind.size());
+								const napi_value message = bufferToUint8Array(environment, result->message.data(), result->message.size());
+								if(napi_create_uint32(environment, result->index, &index) == napi_ok && napi_set_named_property(environment, resultObject, "Index", index) == napi_ok && napi_create_string_utf8(environment, result->value.data(), NAPI_AUTO_LENGTH, &value) == napi_ok && napi_set_named_property(environment, resultObject, "Value", value) == napi_ok && !isNull(environment, blind) && napi_set_named_property(environment, resultObject, "Blind", blind) == napi_ok && !isNull(environment, message) && napi_set_named_property(environment, resultObject, "Message", message) == napi_ok) {
+								
+									// Check if getting the number of proofs processed and undefined was successful
+									array<napi_value, 2> callbackArguments = {nullptr, resultObject};
+									napi_value undefined;
+									if(napi_create_uint32(environment, processed, &callbackArguments[0]) == napi_ok && napi_get_undefined(environment, &undefined) == napi_ok) {
+									
+										// Call callback with the number of proofs processed and the result object
+										napi_call_function(environment, undefined, callback, callbackArguments.size(), callbackArguments.data(), nullptr);
+									}
+								}
+							}
+						}
+						
+						// Clear result
+						clearRewindScanResult(*result);
+					})) {
+					
+						// Clear result
+						clearRewindScanResult(*result);
+						
+						// Set stream failed
+						streamFailed = true;
+					}
+				}
+				
+				// Otherwise
+				else {
+				
+					// Clear result
+					clearRewindScanResult(*result);
+				}
+			}
+			
+			// Check if streaming progress is required and it failed
+			const uint32_t processed = i + 1;
+			if(!streamFailed && (processed % REWIND_SCAN_PROGRESS_INTERVAL == 0 || processed == numberOfProofs) && !streamEvent(callback, task->abortSignal.aborted.get(), [processed](napi_env environment, napi_value callback) {
+			
+				// Check if environment exists
+				if(environment) {
+				
+					// Check if getting the number of proofs processed, null, and undefined was successful
+					array<napi_value, 2> callbackArguments;
+					napi_value undefined;
+					if(napi_create_uint32(environment, processed, &callbackArguments[0]) == napi_ok && napi_get_null(environment, &callbackArguments[1]) == napi_ok && napi_get_undefined(environment, &undefined) == napi_ok) {
+					
+						// Call callback with the number of proofs processed and no result
+						napi_call_function(environment, undefined, callback, callbackArguments.size(), callbackArguments.data(), nullptr);
+					}
+				}
+			})) {
+			
+				// Set stream failed
+				streamFailed = true;
+			}
+		}
+		
+		// Destroy cache
+		bulletproofRewindCacheDestroy(cache);
+		
+		// Clear task's nonce
+		secureClear(task->nonce.data(), task->nonce.size());
+		
+		// Set task's result to if all proofs were scanned and streamed
+		task->result = !streamFailed && !*task->abortSignal.aborted;
+		
+	}, [task](napi_env environment) -> napi_value {
+	
+		// Release task's abort signal
+		releaseAbortSignal(environment, task->abortSignal);
+		
+		// Check if task was aborted
+		if(*task->abortSignal.aborted) {
+		
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Return task's result as a bool
+		return cBoolToBool(environment, task->result);
+	});
 }
 
-// Secret key tweak multiply
-napi_value secretKeyTweakMultiply(napi_env environment, napi_callback_info arguments) {
+// Validate block
+napi_value validateBlock(napi_env environment, napi_callback_info arguments) {
+
+	// Return performing validation on a block
+	return performValidation(environment, arguments, "validateBlock", true);
+}
+
+// Validate transaction
+napi_value validateTransaction(napi_env environment, napi_callback_info arguments) {
+
+	// Return performing validation on a transaction
+	return performValidation(environment, arguments, "validateTransaction", false);
+}
+
+// Public key from secret key
+napi_value publicKeyFromSecretKey(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
 	InstanceData *instanceData = getInstanceData(environment);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 2;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting secret key from arguments failed
@@ -1449,340 +3025,289 @@ napi_value secretKeyTweakMultiply(napi_env environment, napi_callback_info argum
 	if(!get<2>(secretKey)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
-	}
-	
-	// Check if getting tweak from arguments failed
-	const tuple<uint8_t *, size_t, bool> tweak = uint8ArrayToBuffer(environment, argv[1]);
-	if(!get<2>(tweak)) {
-	
-		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if performing secret key tweak multiply failed
-	vector<uint8_t> result(Secp256k1Zkp::secretKeySize(instanceData));
-	if(!Secp256k1Zkp::secretKeyTweakMultiply(instanceData, result.data(), get<0>(secretKey), get<1>(secretKey), get<0>(tweak), get<1>(tweak))) {
+	// Check if getting public key from secret key failed
+	array<uint8_t, PUBLIC_KEY_SIZE> publicKey;
+	if(!Secp256k1Zkp::publicKeyFromSecretKey(instanceData, publicKey.data(), get<0>(secretKey), get<1>(secretKey))) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Return result as a uint8 array
-	return bufferToUint8Array(environment, result.data(), result.size());
+	// Return public key as a uint8 array
+	return bufferToUint8Array(environment, publicKey.data(), publicKey.size());
 }
 
-// Public key tweak multiply
-napi_value publicKeyTweakMultiply(napi_env environment, napi_callback_info arguments) {
+// Public key from data
+napi_value publicKeyFromData(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
 	InstanceData *instanceData = getInstanceData(environment);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 2;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
-	
-		// Return operation failed
-		return OPERATION_FAILED;
-	}
-	
-	// Check if getting public key from arguments failed
-	const tuple<uint8_t *, size_t, bool> publicKey = uint8ArrayToBuffer(environment, argv[0]);
-	if(!get<2>(publicKey)) {
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting tweak from arguments failed
-	const tuple<uint8_t *, size_t, bool> tweak = uint8ArrayToBuffer(environment, argv[1]);
-	if(!get<2>(tweak)) {
+	// Check if getting data from arguments failed
+	const tuple<uint8_t *, size_t, bool> data = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(data)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if performing public key tweak multiply failed
-	vector<uint8_t> result(Secp256k1Zkp::publicKeySize(instanceData));
-	if(!Secp256k1Zkp::publicKeyTweakMultiply(instanceData, result.data(), get<0>(publicKey), get<1>(publicKey), get<0>(tweak), get<1>(tweak))) {
+	// Check if getting public key from data failed
+	array<uint8_t, PUBLIC_KEY_SIZE> publicKey;
+	if(!Secp256k1Zkp::publicKeyFromData(instanceData, publicKey.data(), get<0>(data), get<1>(data))) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Return result as a uint8 array
-	return bufferToUint8Array(environment, result.data(), result.size());
+	// Return public key as a uint8 array
+	return bufferToUint8Array(environment, publicKey.data(), publicKey.size());
 }
 
-// Shared secret key from secret key and public key
-napi_value sharedSecretKeyFromSecretKeyAndPublicKey(napi_env environment, napi_callback_info arguments) {
+// Uncompress public key
+napi_value uncompressPublicKey(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
 	InstanceData *instanceData = getInstanceData(environment);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 2;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
-	
-		// Return operation failed
-		return OPERATION_FAILED;
-	}
-	
-	// Check if getting secret key from arguments failed
-	const tuple<uint8_t *, size_t, bool> secretKey = uint8ArrayToBuffer(environment, argv[0]);
-	if(!get<2>(secretKey)) {
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting public key from arguments failed
-	const tuple<uint8_t *, size_t, bool> publicKey = uint8ArrayToBuffer(environment, argv[1]);
+	const tuple<uint8_t *, size_t, bool> publicKey = uint8ArrayToBuffer(environment, argv[0]);
 	if(!get<2>(publicKey)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting shared secret key from secret key and public key failed
-	vector<uint8_t> sharedSecretKey(Secp256k1Zkp::secretKeySize(instanceData));
-	if(!Secp256k1Zkp::sharedSecretKeyFromSecretKeyAndPublicKey(instanceData, sharedSecretKey.data(), get<0>(secretKey), get<1>(secretKey), get<0>(publicKey), get<1>(publicKey))) {
+	// Check if uncompressing the public key failed
+	array<uint8_t, UNCOMPRESSED_PUBLIC_KEY_SIZE> uncompressedPublicKey;
+	if(!Secp256k1Zkp::uncompressPublicKey(instanceData, uncompressedPublicKey.data(), get<0>(publicKey), get<1>(publicKey))) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Return shared secret key as a uint8 array
-	return bufferToUint8Array(environment, sharedSecretKey.data(), sharedSecretKey.size());
+	// Return uncompressed public key as a uint8 array
+	return bufferToUint8Array(environment, uncompressedPublicKey.data(), uncompressedPublicKey.size());
 }
 
-// Pedersen commit
-napi_value pedersenCommit(napi_env environment, napi_callback_info arguments) {
+// Secret key tweak add
+napi_value secretKeyTweakAdd(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
 	InstanceData *instanceData = getInstanceData(environment);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 2;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 2> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting blind from arguments failed
-	const tuple<uint8_t *, size_t, bool> blind = uint8ArrayToBuffer(environment, argv[0]);
-	if(!get<2>(blind)) {
+	// Check if getting secret key from arguments failed
+	const tuple<uint8_t *, size_t, bool> secretKey = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(secretKey)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting value from arguments failed
-	const tuple<string, bool> value = stringToCString(environment, argv[1]);
-	if(!get<1>(value)) {
+	// Check if getting tweak from arguments failed
+	const tuple<uint8_t *, size_t, bool> tweak = uint8ArrayToBuffer(environment, argv[1]);
+	if(!get<2>(tweak)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if performing Pedersen commit failed
-	vector<uint8_t> result(Secp256k1Zkp::commitSize(instanceData));
-	if(!Secp256k1Zkp::pedersenCommit(instanceData, result.data(), get<0>(blind), get<1>(blind), get<0>(value).c_str())) {
+	// Check if allocating result failed
+	uint8_t *result = secureAllocate(instanceData, SECRET_KEY_SIZE);
+	if(!result) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if performing secret key tweak add failed
+	if(!Secp256k1Zkp::secretKeyTweakAdd(instanceData, result, get<0>(secretKey), get<1>(secretKey), get<0>(tweak), get<1>(tweak))) {
 	
+		// Free result
+		secureFree(instanceData, result);
+		
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
+	// Get result as a uint8 array
+	const napi_value uint8ArrayResult = bufferToUint8Array(environment, result, SECRET_KEY_SIZE);
+	
+	// Free result
+	secureFree(instanceData, result);
+	
 	// Return result as a uint8 array
-	return bufferToUint8Array(environment, result.data(), result.size());
+	return uint8ArrayResult;
 }
 
-// Pedersen commit sum
-napi_value pedersenCommitSum(napi_env environment, napi_callback_info arguments) {
+// Public key tweak add
+napi_value publicKeyTweakAdd(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
-	InstanceData *instanceData = getInstanceData(environment);
+	InstanceData *instanceData = getInstanceData(environment, VERIFY_CAPABILITY);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
-	
+
 	// Check if not enough arguments were provided
-	size_t argc = 2;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 2> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting number of positive commits from arguments failed
-	bool isArray;
-	uint32_t numberOfPositiveCommits;
-	if(napi_is_array(environment, argv[0], &isArray) != napi_ok || !isArray || napi_get_array_length(environment, argv[0], &numberOfPositiveCommits) != napi_ok) {
+	// Check if getting public key from arguments failed
+	const tuple<uint8_t *, size_t, bool> publicKey = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(publicKey)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
-	}
-	
-	// Initialize positive commits and positive commits sizes
-	vector<uint8_t> positiveCommits;
-	vector<size_t> positiveCommitsSizes(numberOfPositiveCommits);
-	
-	// Go through all positive commits
-	for(uint32_t i = 0; i < numberOfPositiveCommits; ++i) {
-	
-		// Check if getting commit failed
-		napi_value commit;
-		if(napi_get_element(environment, argv[0], i, &commit) != napi_ok) {
-		
-			// Return operation failed
-			return OPERATION_FAILED;
-		}
-		
-		// Check if getting commit as a buffer failed
-		const tuple<uint8_t *, size_t, bool> commitBuffer = uint8ArrayToBuffer(environment, commit);
-		if(!get<2>(commitBuffer)) {
-		
-			// Return operation failed
-			return OPERATION_FAILED;
-		}
-		
-		// Append commit buffer to positive commits
-		positiveCommits.insert(positiveCommits.cend(), get<0>(commitBuffer), get<0>(commitBuffer) + get<1>(commitBuffer));
-		
-		// Append commit's size to positive commits sizes
-		positiveCommitsSizes[i] = get<1>(commitBuffer);
+		return operationFailed(environment);
 	}
 	
-	// Check if getting number of negative commits from arguments failed
-	uint32_t numberOfNegativeCommits;
-	if(napi_is_array(environment, argv[1], &isArray) != napi_ok || !isArray || napi_get_array_length(environment, argv[1], &numberOfNegativeCommits) != napi_ok) {
+	// Check if getting tweak from arguments failed
+	const tuple<uint8_t *, size_t, bool> tweak = uint8ArrayToBuffer(environment, argv[1]);
+	if(!get<2>(tweak)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
-	}
-	
-	// Initialize negative commits and negative commits sizes
-	vector<uint8_t> negativeCommits;
-	vector<size_t> negativeCommitsSizes(numberOfNegativeCommits);
-	
-	// Go through all negative commits
-	for(uint32_t i = 0; i < numberOfNegativeCommits; ++i) {
-	
-		// Check if getting commit failed
-		napi_value commit;
-		if(napi_get_element(environment, argv[1], i, &commit) != napi_ok) {
-		
-			// Return operation failed
-			return OPERATION_FAILED;
-		}
-		
-		// Check if getting commit as a buffer failed
-		const tuple<uint8_t *, size_t, bool> commitBuffer = uint8ArrayToBuffer(environment, commit);
-		if(!get<2>(commitBuffer)) {
-		
-			// Return operation failed
-			return OPERATION_FAILED;
-		}
-		
-		// Append commit buffer to negative commits
-		negativeCommits.insert(negativeCommits.cend(), get<0>(commitBuffer), get<0>(commitBuffer) + get<1>(commitBuffer));
-		
-		// Append commit's size to negative commits sizes
-		negativeCommitsSizes[i] = get<1>(commitBuffer);
+		return operationFailed(environment);
 	}
 	
-	// Check if performing Pedersen commit sum failed
-	vector<uint8_t> result(Secp256k1Zkp::commitSize(instanceData));
-	if(!Secp256k1Zkp::pedersenCommitSum(instanceData, result.data(), positiveCommits.data(), positiveCommitsSizes.data(), numberOfPositiveCommits, negativeCommits.data(), negativeCommitsSizes.data(), numberOfNegativeCommits)) {
+	// Check if performing public key tweak add failed
+	array<uint8_t, PUBLIC_KEY_SIZE> result;
+	if(!Secp256k1Zkp::publicKeyTweakAdd(instanceData, result.data(), get<0>(publicKey), get<1>(publicKey), get<0>(tweak), get<1>(tweak))) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Return result as a uint8 array
 	return bufferToUint8Array(environment, result.data(), result.size());
 }
 
-// Pedersen commit to public key
-napi_value pedersenCommitToPublicKey(napi_env environment, napi_callback_info arguments) {
+// Secret key tweak multiply
+napi_value secretKeyTweakMultiply(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
 	InstanceData *instanceData = getInstanceData(environment);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 1;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 2> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting commit from arguments failed
-	const tuple<uint8_t *, size_t, bool> commit = uint8ArrayToBuffer(environment, argv[0]);
-	if(!get<2>(commit)) {
+	// Check if getting secret key from arguments failed
+	const tuple<uint8_t *, size_t, bool> secretKey = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(secretKey)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting public key from Pedersen commit failed
-	vector<uint8_t> publicKey(Secp256k1Zkp::publicKeySize(instanceData));
-	if(!Secp256k1Zkp::pedersenCommitToPublicKey(instanceData, publicKey.data(), get<0>(commit), get<1>(commit))) {
+	// Check if getting tweak from arguments failed
+	const tuple<uint8_t *, size_t, bool> tweak = uint8ArrayToBuffer(environment, argv[1]);
+	if(!get<2>(tweak)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Return public key as a uint8 array
-	return bufferToUint8Array(environment, publicKey.data(), publicKey.size());
+	// Check if allocating result failed
+	uint8_t *result = secureAllocate(instanceData, SECRET_KEY_SIZE);
+	if(!result) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if performing secret key tweak multiply failed
+	if(!Secp256k1Zkp::secretKeyTweakMultiply(instanceData, result, get<0>(secretKey), get<1>(secretKey), get<0>(tweak), get<1>(tweak))) {
+	
+		// Free result
+		secureFree(instanceData, result);
+		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Get result as a uint8 array
+	const napi_value uint8ArrayResult = bufferToUint8Array(environment, result, SECRET_KEY_SIZE);
+	
+	// Free result
+	secureFree(instanceData, result);
+	
+	// Return result as a uint8 array
+	return uint8ArrayResult;
 }
 
-// Public key to Pedersen commit
-napi_value publicKeyToPedersenCommit(napi_env environment, napi_callback_info arguments) {
+// Public key tweak multiply
+napi_value publicKeyTweakMultiply(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
-	InstanceData *instanceData = getInstanceData(environment);
+	InstanceData *instanceData = getInstanceData(environment, VERIFY_CAPABILITY);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 1;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 2> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting public key from arguments failed
@@ -1790,611 +3315,3916 @@ napi_value publicKeyToPedersenCommit(napi_env environment, napi_callback_info ar
 	if(!get<2>(publicKey)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting Pedersen commit from public key failed
-	vector<uint8_t> commit(Secp256k1Zkp::commitSize(instanceData));
-	if(!Secp256k1Zkp::publicKeyToPedersenCommit(instanceData, commit.data(), get<0>(publicKey), get<1>(publicKey))) {
+	// Check if getting tweak from arguments failed
+	const tuple<uint8_t *, size_t, bool> tweak = uint8ArrayToBuffer(environment, argv[1]);
+	if(!get<2>(tweak)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Return commit as a uint8 array
-	return bufferToUint8Array(environment, commit.data(), commit.size());
+	// Check if performing public key tweak multiply failed
+	array<uint8_t, PUBLIC_KEY_SIZE> result;
+	if(!Secp256k1Zkp::publicKeyTweakMultiply(instanceData, result.data(), get<0>(publicKey), get<1>(publicKey), get<0>(tweak), get<1>(tweak))) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return result as a uint8 array
+	return bufferToUint8Array(environment, result.data(), result.size());
 }
 
-// Create single-signer signature
-napi_value createSingleSignerSignature(napi_env environment, napi_callback_info arguments) {
+// Shared secret key from secret key and public key
+napi_value sharedSecretKeyFromSecretKeyAndPublicKey(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
 	InstanceData *instanceData = getInstanceData(environment);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 6;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
-	
-		// Return operation failed
-		return OPERATION_FAILED;
-	}
-	
-	// Check if getting message from arguments failed
-	const tuple<uint8_t *, size_t, bool> message = uint8ArrayToBuffer(environment, argv[0]);
-	if(!get<2>(message)) {
+	array<napi_value, 2> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting secret key from arguments failed
-	const tuple<uint8_t *, size_t, bool> secretKey = uint8ArrayToBuffer(environment, argv[1]);
+	const tuple<uint8_t *, size_t, bool> secretKey = uint8ArrayToBuffer(environment, argv[0]);
 	if(!get<2>(secretKey)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
-	}
-	
-	// Check if getting secret nonce from arguments failed
-	const tuple<uint8_t *, size_t, bool> secretNonce = uint8ArrayToBuffer(environment, argv[2]);
-	if(!get<2>(secretNonce) && !isNull(environment, argv[2], false)) {
-	
-		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if getting public key from arguments failed
-	const tuple<uint8_t *, size_t, bool> publicKey = uint8ArrayToBuffer(environment, argv[3]);
+	const tuple<uint8_t *, size_t, bool> publicKey = uint8ArrayToBuffer(environment, argv[1]);
 	if(!get<2>(publicKey)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
-	}
-	
-	// Check if getting public nonce from arguments failed
-	const tuple<uint8_t *, size_t, bool> publicNonce = uint8ArrayToBuffer(environment, argv[4]);
-	if(!get<2>(publicNonce) && !isNull(environment, argv[4], false)) {
-	
-		// Return operation failed
-		return OPERATION_FAILED;
-	}
-	
-	// Check if getting public nonce total from arguments failed
-	const tuple<uint8_t *, size_t, bool> publicNonceTotal = uint8ArrayToBuffer(environment, argv[5]);
-	if(!get<2>(publicNonceTotal) && !isNull(environment, argv[5], false)) {
-	
-		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if creating random seed failed
-	vector<uint8_t> seed(Secp256k1Zkp::seedSize(instanceData));
-	if(!randomFill(environment, seed.data(), seed.size())) {
+	// Check if allocating shared secret key failed
+	uint8_t *sharedSecretKey = secureAllocate(instanceData, SECRET_KEY_SIZE);
+	if(!sharedSecretKey) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if creating single-signer signature failed
-	vector<uint8_t> signature(Secp256k1Zkp::singleSignerSignatureSize(instanceData));
-	if(!Secp256k1Zkp::createSingleSignerSignature(instanceData, signature.data(), get<0>(message), get<1>(message), get<0>(secretKey), get<1>(secretKey), get<0>(secretNonce), get<1>(secretNonce), get<0>(publicKey), get<1>(publicKey), get<0>(publicNonce), get<1>(publicNonce), get<0>(publicNonceTotal), get<1>(publicNonceTotal), seed.data(), seed.size())) {
+	// Check if getting shared secret key from secret key and public key failed
+	if(!Secp256k1Zkp::sharedSecretKeyFromSecretKeyAndPublicKey(instanceData, sharedSecretKey, get<0>(secretKey), get<1>(secretKey), get<0>(publicKey), get<1>(publicKey))) {
 	
-		// Clear seed
-		memset(seed.data(), 0, seed.size());
+		// Free shared secret key
+		secureFree(instanceData, sharedSecretKey);
 		
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Clear seed
-	memset(seed.data(), 0, seed.size());
+	// Get shared secret key as a uint8 array
+	const napi_value uint8ArraySharedSecretKey = bufferToUint8Array(environment, sharedSecretKey, SECRET_KEY_SIZE);
 	
-	// Return signature as a uint8 array
-	return bufferToUint8Array(environment, signature.data(), signature.size());
+	// Free shared secret key
+	secureFree(instanceData, sharedSecretKey);
+	
+	// Return shared secret key as a uint8 array
+	return uint8ArraySharedSecretKey;
 }
 
-// Add single-signer signatures
-napi_value addSingleSignerSignatures(napi_env environment, napi_callback_info arguments) {
+// Shared secret keys from secret keys and public keys
+napi_value sharedSecretKeysFromSecretKeysAndPublicKeys(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
 	InstanceData *instanceData = getInstanceData(environment);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if not enough arguments were provided
-	size_t argc = 2;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 3> argv;
+	if(!getArguments(environment, arguments, argv, nullptr, 1)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting number of signatures from arguments failed
-	bool isArray;
-	uint32_t numberOfSignatures;
-	if(napi_is_array(environment, argv[0], &isArray) != napi_ok || !isArray || napi_get_array_length(environment, argv[0], &numberOfSignatures) != napi_ok) {
+	// Check if getting public keys from arguments failed
+	const tuple<uint8_t *, size_t, bool> publicKeys = packedUint8ArrayToBuffer(environment, argv[1], PUBLIC_KEY_SIZE);
+	if(!get<2>(publicKeys)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Initialize signatures and signatures sizes
-	vector<uint8_t> signatures;
-	vector<size_t> signaturesSizes(numberOfSignatures);
+	// Check if getting secret keys from arguments failed or there's not one secret key or one for each public key
+	const tuple<uint8_t *, size_t, bool> secretKeys = packedUint8ArrayToBuffer(environment, argv[0], SECRET_KEY_SIZE);
+	if(!get<2>(secretKeys) || (get<1>(secretKeys) != 1 && get<1>(secretKeys) != get<1>(publicKeys))) {
 	
-	// Go through all signatures
-	for(uint32_t i = 0; i < numberOfSignatures; ++i) {
+		// Return operation failed
+		return operationFailed(environment);
+	}
 	
-		// Check if getting signature failed
-		napi_value signature;
-		if(napi_get_element(environment, argv[0], i, &signature) != napi_ok) {
+	// Check if creating task failed
+	shared_ptr<SharedSecretKeysTask> task(new(nothrow) SharedSecretKeysTask, [](SharedSecretKeysTask *task) {
+	
+		// Check if task exists
+		if(task) {
 		
-			// Return operation failed
-			return OPERATION_FAILED;
+			// Clear task's secret keys and shared secret keys
+			secureClear(task->secretKeys.data(), task->secretKeys.size());
+			secureClear(task->sharedSecretKeys.data(), task->sharedSecretKeys.size());
+			
+			// Free memory
+			delete task;
 		}
+	});
+	if(!task) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Set task's secret keys, public keys, and shared secret keys
+	task->secretKeys.assign(get<0>(secretKeys), get<0>(secretKeys) + get<1>(secretKeys) * SECRET_KEY_SIZE);
+	task->publicKeys.assign(get<0>(publicKeys), get<0>(publicKeys) + get<1>(publicKeys) * PUBLIC_KEY_SIZE);
+	task->sharedSecretKeys.resize(get<1>(publicKeys) * SECRET_KEY_SIZE);
+	task->result = false;
+	
+	// Check if getting abort signal from arguments failed
+	if(!getAbortSignal(environment, argv[2], task->abortSignal)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return queueing task
+	return queueAsyncTask(environment, "sharedSecretKeysFromSecretKeysAndPublicKeys", INTERACTIVE_PRIORITY, task->abortSignal.aborted, [instanceData, task]() {
+	
+		// Get number of public keys and if using the same secret key for all of them
+		const size_t numberOfPublicKeys = task->publicKeys.size() / PUBLIC_KEY_SIZE;
+		const bool singleSecretKey = task->secretKeys.size() == SECRET_KEY_SIZE;
 		
-		// Check if getting signature as a buffer failed
-		const tuple<uint8_t *, size_t, bool> signatureBuffer = uint8ArrayToBuffer(environment, signature);
-		if(!get<2>(signatureBuffer)) {
+		// Set task's result to if getting the shared secret key for all public keys in parallel was successful
+		task->result = runInParallel(instanceData, INTERACTIVE_PRIORITY, nullptr, numberOfPublicKeys, SHARED_SECRET_KEYS_PER_BATCH, [instanceData, &task, singleSecretKey](size_t start, size_t end, secp256k1_scratch_space *scratchSpace) -> bool {
+		
+			// Go through all public keys in the batch
+			for(size_t i = start; i < end; ++i) {
+			
+				// Check if getting shared secret key from the secret key and public key failed
+				if(!Secp256k1Zkp::sharedSecretKeyFromSecretKeyAndPublicKey(instanceData, &task->sharedSecretKeys[i * SECRET_KEY_SIZE], &task->secretKeys[singleSecretKey ? 0 : i * SECRET_KEY_SIZE], SECRET_KEY_SIZE, &task->publicKeys[i * PUBLIC_KEY_SIZE], PUBLIC_KEY_SIZE)) {
+				
+					// Return false
+					return false;
+				}
+			}
+			
+			// Return true
+			return true;
+			
+		}, task->abortSignal.aborted.get());
+		
+	}, [task](napi_env environment) -> napi_value {
+	
+		// Release task's abort signal
+		releaseAbortSignal(environment, task->abortSignal);
+		
+		// Check if task failed or was aborted
+		if(!task->result || *task->abortSignal.aborted) {
 		
 			// Return operation failed
-			return OPERATION_FAILED;
+			return operationFailed(environment);
 		}
 		
-		// Append signature buffer to signatures
-		signatures.insert(signatures.cend(), get<0>(signatureBuffer), get<0>(signatureBuffer) + get<1>(signatureBuffer));
-		
-		// Append signature's size to signatures sizes
-		signaturesSizes[i] = get<1>(signatureBuffer);
+		// Return task's shared secret keys as a uint8 array
+		return bufferToUint8Array(environment, task->sharedSecretKeys.data(), task->sharedSecretKeys.size());
+	});
+}
+
+// Pedersen commit
+napi_value pedersenCommit(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment);
+	if(!instanceData) {
+	
+		// Return operation failed
+		return operationFailed(environment);
 	}
+
+	// Check if not enough arguments were provided
+	array<napi_value, 2> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
-	// Check if getting public nonce total from arguments failed
-	const tuple<uint8_t *, size_t, bool> publicNonceTotal = uint8ArrayToBuffer(environment, argv[1]);
-	if(!get<2>(publicNonceTotal)) {
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting blind from arguments failed
+	const tuple<uint8_t *, size_t, bool> blind = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(blind)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if adding single-signer signatures failed
-	vector<uint8_t> result(Secp256k1Zkp::singleSignerSignatureSize(instanceData));
-	if(!Secp256k1Zkp::addSingleSignerSignatures(instanceData, result.data(), signatures.data(), signaturesSizes.data(), numberOfSignatures, get<0>(publicNonceTotal), get<1>(publicNonceTotal))) {
+	// Check if getting value from arguments failed
+	array<char, MAX_64_BIT_INTEGER_STRING_LENGTH> value;
+	if(!stringToCString(environment, argv[1], value)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if performing Pedersen commit failed
+	array<uint8_t, COMMIT_SIZE> result;
+	if(!Secp256k1Zkp::pedersenCommit(instanceData, result.data(), get<0>(blind), get<1>(blind), value.data())) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Return result as a uint8 array
 	return bufferToUint8Array(environment, result.data(), result.size());
 }
 
-// Verify single-signer signature
-napi_value verifySingleSignerSignature(napi_env environment, napi_callback_info arguments) {
+// Pedersen commit sum
+napi_value pedersenCommitSum(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
 	InstanceData *instanceData = getInstanceData(environment);
 	if(!instanceData) {
 	
-		// Return false as a bool
-		return cBoolToBool(environment, false);
+		// Return operation failed
+		return operationFailed(environment);
 	}
-
+	
 	// Check if not enough arguments were provided
-	size_t argc = 6;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 2> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
-		// Return false as a bool
-		return cBoolToBool(environment, false);
+		// Return operation failed
+		return operationFailed(environment);
 	}
 	
-	// Check if getting signature from arguments failed
-	const tuple<uint8_t *, size_t, bool> signature = uint8ArrayToBuffer(environment, argv[0]);
-	if(!get<2>(signature)) {
+	// Check if getting number of positive commits from arguments failed
+	bool isArray;
+	uint32_t numberOfPositiveCommits;
+	if(napi_is_array(environment, argv[0], &isArray) != napi_ok || !isArray || napi_get_array_length(environment, argv[0], &numberOfPositiveCommits) != napi_ok) {
 	
-		// Return false as a bool
-		return cBoolToBool(environment, false);
+		// Return operation failed
+		return operationFailed(environment);
 	}
 	
-	// Check if getting message from arguments failed
-	const tuple<uint8_t *, size_t, bool> message = uint8ArrayToBuffer(environment, argv[1]);
-	if(!get<2>(message)) {
-	
-		// Return false as a bool
-		return cBoolToBool(environment, false);
-	}
+	// Initialize positive commits and positive commits sizes
+	vector<uint8_t> positiveCommits;
+	vector<size_t> positiveCommitsSizes(numberOfPositiveCommits);
 	
-	// Check if getting public nonce from arguments failed
-	const tuple<uint8_t *, size_t, bool> publicNonce = uint8ArrayToBuffer(environment, argv[2]);
-	if(!get<2>(publicNonce) && !isNull(environment, argv[2], false)) {
+	// Go through all positive commits
+	for(uint32_t i = 0; i < numberOfPositiveCommits; ++i) {
 	
-		// Return false as a bool
-		return cBoolToBool(environment, false);
+		// Check if getting commit failed
+		napi_value commit;
+		if(napi_get_element(environment, argv[0], i, &commit) != napi_ok) {
+		
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Check if getting commit as a buffer failed
+		const tuple<uint8_t *, size_t, bool> commitBuffer = uint8ArrayToBuffer(environment, commit);
+		if(!get<2>(commitBuffer)) {
+		
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Append commit buffer to positive commits
+		positiveCommits.insert(positiveCommits.cend(), get<0>(commitBuffer), get<0>(commitBuffer) + get<1>(commitBuffer));
+		
+		// Append commit's size to positive commits sizes
+		positiveCommitsSizes[i] = get<1>(commitBuffer);
 	}
 	
-	// Check if getting public key from arguments failed
-	const tuple<uint8_t *, size_t, bool> publicKey = uint8ArrayToBuffer(environment, argv[3]);
-	if(!get<2>(publicKey)) {
+	// Check if getting number of negative commits from arguments failed
+	uint32_t numberOfNegativeCommits;
+	if(napi_is_array(environment, argv[1], &isArray) != napi_ok || !isArray || napi_get_array_length(environment, argv[1], &numberOfNegativeCommits) != napi_ok) {
 	
-		// Return false as a bool
-		return cBoolToBool(environment, false);
+		// Return operation failed
+		return operationFailed(environment);
 	}
 	
-	// Check if getting public key total from arguments failed
-	const tuple<uint8_t *, size_t, bool> publicKeyTotal = uint8ArrayToBuffer(environment, argv[4]);
-	if(!get<2>(publicKeyTotal)) {
-	
-		// Return false as a bool
-		return cBoolToBool(environment, false);
-	}
+	// Initialize negative commits and negative commits sizes
+	vector<uint8_t> negativeCommits;
+	vector<size_t> negativeCommitsSizes(numberOfNegativeCommits);
 	
-	// Check if getting is partial from arguments failed
-	bool isPartial;
-	if(napi_get_value_bool(environment, argv[5], &isPartial) != napi_ok) {
+	// Go through all negative commits
+	for(uint32_t i = 0; i < numberOfNegativeCommits; ++i) {
 	
-		// Return false as a bool
-		return cBoolToBool(environment, false);
+		// Check if getting commit failed
+		napi_value commit;
+		if(napi_get_element(environment, argv[1], i, &commit) != napi_ok) {
+		
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Check if getting commit as a buffer failed
+		const tuple<uint8_t *, size_t, bool> commitBuffer = uint8ArrayToBuffer(environment, commit);
+		if(!get<2>(commitBuffer)) {
+		
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Append commit buffer to negative commits
+		negativeCommits.insert(negativeCommits.cend(), get<0>(commitBuffer), get<0>(commitBuffer) + get<1>(commitBuffer));
+		
+		// Append commit's size to negative commits sizes
+		negativeCommitsSizes[i] = get<1>(commitBuffer);
 	}
 	
-	// Check if single-signer signature isn't verified
-	if(!Secp256k1Zkp::verifySingleSignerSignature(instanceData, get<0>(signature), get<1>(signature), get<0>(message), get<1>(message), get<0>(publicNonce), get<1>(publicNonce), get<0>(publicKey), get<1>(publicKey), get<0>(publicKeyTotal), get<1>(publicKeyTotal), isPartial)) {
+	// Check if performing Pedersen commit sum failed
+	array<uint8_t, COMMIT_SIZE> result;
+	if(!Secp256k1Zkp::pedersenCommitSum(instanceData, result.data(), positiveCommits.data(), positiveCommitsSizes.data(), numberOfPositiveCommits, negativeCommits.data(), negativeCommitsSizes.data(), numberOfNegativeCommits)) {
 	
-		// Return false as a bool
-		return cBoolToBool(environment, false);
+		// Return operation failed
+		return operationFailed(environment);
 	}
 	
-	// Return true as a bool
-	return cBoolToBool(environment, true);
+	// Return result as a uint8 array
+	return bufferToUint8Array(environment, result.data(), result.size());
 }
 
-// Single-signer signature from data
-napi_value singleSignerSignatureFromData(napi_env environment, napi_callback_info arguments) {
+// Pedersen commit to public key
+napi_value pedersenCommitToPublicKey(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
 	InstanceData *instanceData = getInstanceData(environment);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 1;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting data from arguments failed
-	const tuple<uint8_t *, size_t, bool> data = uint8ArrayToBuffer(environment, argv[0]);
-	if(!get<2>(data)) {
+	// Check if getting commit from arguments failed
+	const tuple<uint8_t *, size_t, bool> commit = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(commit)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting single-signer signature from data failed
-	vector<uint8_t> signature(Secp256k1Zkp::singleSignerSignatureSize(instanceData));
-	if(!Secp256k1Zkp::singleSignerSignatureFromData(instanceData, signature.data(), get<0>(data), get<1>(data))) {
+	// Check if getting public key from Pedersen commit failed
+	array<uint8_t, PUBLIC_KEY_SIZE> publicKey;
+	if(!Secp256k1Zkp::pedersenCommitToPublicKey(instanceData, publicKey.data(), get<0>(commit), get<1>(commit))) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Return signature as a uint8 array
-	return bufferToUint8Array(environment, signature.data(), signature.size());
+	// Return public key as a uint8 array
+	return bufferToUint8Array(environment, publicKey.data(), publicKey.size());
 }
 
-// Compact single-signer signature
-napi_value compactSingleSignerSignature(napi_env environment, napi_callback_info arguments) {
+// Public key to Pedersen commit
+napi_value publicKeyToPedersenCommit(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
 	InstanceData *instanceData = getInstanceData(environment);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 1;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting signature from arguments failed
-	const tuple<uint8_t *, size_t, bool> signature = uint8ArrayToBuffer(environment, argv[0]);
-	if(!get<2>(signature)) {
+	// Check if getting public key from arguments failed
+	const tuple<uint8_t *, size_t, bool> publicKey = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(publicKey)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if compacting single-signer signature failed
-	vector<uint8_t> result(Secp256k1Zkp::singleSignerSignatureSize(instanceData));
-	if(!Secp256k1Zkp::compactSingleSignerSignature(instanceData, result.data(), get<0>(signature), get<1>(signature))) {
+	// Check if getting Pedersen commit from public key failed
+	array<uint8_t, COMMIT_SIZE> commit;
+	if(!Secp256k1Zkp::publicKeyToPedersenCommit(instanceData, commit.data(), get<0>(publicKey), get<1>(publicKey))) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Return result as a uint8 array
-	return bufferToUint8Array(environment, result.data(),result.size());
+	// Return commit as a uint8 array
+	return bufferToUint8Array(environment, commit.data(), commit.size());
 }
 
-// Uncompact single-signer signature
-napi_value uncompactSingleSignerSignature(napi_env environment, napi_callback_info arguments) {
+// Create single-signer signature
+napi_value createSingleSignerSignature(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
 	InstanceData *instanceData = getInstanceData(environment);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 
 	// Check if not enough arguments were provided
-	size_t argc = 1;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 6> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting signature from arguments failed
-	const tuple<uint8_t *, size_t, bool> signature = uint8ArrayToBuffer(environment, argv[0]);
-	if(!get<2>(signature)) {
+	// Check if getting message from arguments failed
+	const tuple<uint8_t *, size_t, bool> message = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(message)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if uncompacting single-signer signature failed
-	vector<uint8_t> result(Secp256k1Zkp::uncompactSingleSignerSignatureSize(instanceData));
-	if(!Secp256k1Zkp::uncompactSingleSignerSignature(instanceData, result.data(), get<0>(signature), get<1>(signature))) {
+	// Check if getting secret key from arguments failed
+	const tuple<uint8_t *, size_t, bool> secretKey = uint8ArrayToBuffer(environment, argv[1]);
+	if(!get<2>(secretKey)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Return result as a uint8 array
-	return bufferToUint8Array(environment, result.data(), result.size());
+	// Check if getting secret nonce from arguments failed
+	const tuple<uint8_t *, size_t, bool> secretNonce = uint8ArrayToBuffer(environment, argv[2]);
+	if(!get<2>(secretNonce) && !isNull(environment, argv[2], false)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting public key from arguments failed
+	const tuple<uint8_t *, size_t, bool> publicKey = uint8ArrayToBuffer(environment, argv[3]);
+	if(!get<2>(publicKey)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting public nonce from arguments failed
+	const tuple<uint8_t *, size_t, bool> publicNonce = uint8ArrayToBuffer(environment, argv[4]);
+	if(!get<2>(publicNonce) && !isNull(environment, argv[4], false)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting public nonce total from arguments failed
+	const tuple<uint8_t *, size_t, bool> publicNonceTotal = uint8ArrayToBuffer(environment, argv[5]);
+	if(!get<2>(publicNonceTotal) && !isNull(environment, argv[5], false)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if allocating seed failed
+	uint8_t *seed = secureAllocate(instanceData, SEED_SIZE);
+	if(!seed) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if creating random seed failed
+	if(!randomFill(environment, seed, SEED_SIZE)) {
+	
+		// Free seed
+		secureFree(instanceData, seed);
+		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if creating single-signer signature failed
+	array<uint8_t, SINGLE_SIGNER_SIGNATURE_SIZE> signature;
+	if(!Secp256k1Zkp::createSingleSignerSignature(instanceData, signature.data(), get<0>(message), get<1>(message), get<0>(secretKey), get<1>(secretKey), get<0>(secretNonce), get<1>(secretNonce), get<0>(publicKey), get<1>(publicKey), get<0>(publicNonce), get<1>(publicNonce), get<0>(publicNonceTotal), get<1>(publicNonceTotal), seed, SEED_SIZE)) {
+	
+		// Free seed
+		secureFree(instanceData, seed);
+		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Free seed
+	secureFree(instanceData, seed);
+	
+	// Count signing operation
+	countSigningOperation(environment, instanceData);
+	
+	// Return signature as a uint8 array
+	return bufferToUint8Array(environment, signature.data(), signature.size());
 }
 
-// Combine public keys
-napi_value combinePublicKeys(napi_env environment, napi_callback_info arguments) {
+// Add single-signer signatures
+napi_value addSingleSignerSignatures(napi_env environment, napi_callback_info arguments) {
 
 	// Check if getting instance data failed
 	InstanceData *instanceData = getInstanceData(environment);
 	if(!instanceData) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Check if not enough arguments were provided
-	size_t argc = 1;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+	array<napi_value, 2> argv;
+	if(!getArguments(environment, arguments, argv)) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if getting number of public keys from arguments failed
+	// Check if getting number of signatures from arguments failed
 	bool isArray;
-	uint32_t numberOfPublicKeys;
-	if(napi_is_array(environment, argv[0], &isArray) != napi_ok || !isArray || napi_get_array_length(environment, argv[0], &numberOfPublicKeys) != napi_ok) {
+	uint32_t numberOfSignatures;
+	if(napi_is_array(environment, argv[0], &isArray) != napi_ok || !isArray || napi_get_array_length(environment, argv[0], &numberOfSignatures) != napi_ok) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Initialize public keys and public keys sizes
-	vector<uint8_t> publicKeys;
-	vector<size_t> publicKeysSizes(numberOfPublicKeys);
+	// Initialize signatures and signatures sizes
+	vector<uint8_t> signatures;
+	vector<size_t> signaturesSizes(numberOfSignatures);
 	
-	// Go through all public keys
-	for(uint32_t i = 0; i < numberOfPublicKeys; ++i) {
+	// Go through all signatures
+	for(uint32_t i = 0; i < numberOfSignatures; ++i) {
+	
+		// Check if getting signature failed
+		napi_value signature;
+		if(napi_get_element(environment, argv[0], i, &signature) != napi_ok) {
+		
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Check if getting signature as a buffer failed
+		const tuple<uint8_t *, size_t, bool> signatureBuffer = uint8ArrayToBuffer(environment, signature);
+		if(!get<2>(signatureBuffer)) {
+		
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Append signature buffer to signatures
+		signatures.insert(signatures.cend(), get<0>(signatureBuffer), get<0>(signatureBuffer) + get<1>(signatureBuffer));
+		
+		// Append signature's size to signatures sizes
+		signaturesSizes[i] = get<1>(signatureBuffer);
+	}
+	
+	// Check if getting public nonce total from arguments failed
+	const tuple<uint8_t *, size_t, bool> publicNonceTotal = uint8ArrayToBuffer(environment, argv[1]);
+	if(!get<2>(publicNonceTotal)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if adding single-signer signatures failed
+	array<uint8_t, SINGLE_SIGNER_SIGNATURE_SIZE> result;
+	if(!Secp256k1Zkp::addSingleSignerSignatures(instanceData, result.data(), signatures.data(), signaturesSizes.data(), numberOfSignatures, get<0>(publicNonceTotal), get<1>(publicNonceTotal))) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return result as a uint8 array
+	return bufferToUint8Array(environment, result.data(), result.size());
+}
+
+// Verify single-signer signature
+napi_value verifySingleSignerSignature(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment, VERIFY_CAPABILITY);
+	if(!instanceData) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+
+	// Check if not enough arguments were provided
+	array<napi_value, 6> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting signature from arguments failed
+	const tuple<uint8_t *, size_t, bool> signature = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(signature)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting message from arguments failed
+	const tuple<uint8_t *, size_t, bool> message = uint8ArrayToBuffer(environment, argv[1]);
+	if(!get<2>(message)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting public nonce from arguments failed
+	const tuple<uint8_t *, size_t, bool> publicNonce = uint8ArrayToBuffer(environment, argv[2]);
+	if(!get<2>(publicNonce) && !isNull(environment, argv[2], false)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting public key from arguments failed
+	const tuple<uint8_t *, size_t, bool> publicKey = uint8ArrayToBuffer(environment, argv[3]);
+	if(!get<2>(publicKey)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting public key total from arguments failed
+	const tuple<uint8_t *, size_t, bool> publicKeyTotal = uint8ArrayToBuffer(environment, argv[4]);
+	if(!get<2>(publicKeyTotal)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting is partial from arguments failed
+	bool isPartial;
+	if(napi_get_value_bool(environment, argv[5], &isPartial) != napi_ok) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if single-signer signature was already verified
+	string signatureCacheKey;
+	const uint8_t partial = isPartial;
+	if(verificationCacheContains(&instanceData->signatureCache, signatureCacheKey, {{&SINGLE_SIGNER_SIGNATURE_CACHE_TAG, sizeof(SINGLE_SIGNER_SIGNATURE_CACHE_TAG)}, {get<0>(signature), get<1>(signature)}, {get<0>(message), get<1>(message)}, {get<0>(publicNonce), get<1>(publicNonce)}, {get<0>(publicKey), get<1>(publicKey)}, {get<0>(publicKeyTotal), get<1>(publicKeyTotal)}, {&partial, sizeof(partial)}})) {
+	
+		// Return true as a bool
+		return cBoolToBool(environment, true);
+	}
+	
+	// Check if single-signer signature isn't verified
+	if(!Secp256k1Zkp::verifySingleSignerSignature(instanceData, get<0>(signature), get<1>(signature), get<0>(message), get<1>(message), get<0>(publicNonce), get<1>(publicNonce), get<0>(publicKey), get<1>(publicKey), get<0>(publicKeyTotal), get<1>(publicKeyTotal), isPartial)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if single-signer signature was added to the signature cache as a new entry
+	if(verificationCacheAdd(&instanceData->signatureCache, signatureCacheKey)) {
+	
+		// Update external memory
+		updateExternalMemory(environment, instanceData);
+	}
+	
+	// Return true as a bool
+	return cBoolToBool(environment, true);
+}
+
+// Single-signer signature from data
+napi_value singleSignerSignatureFromData(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment);
+	if(!instanceData) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+
+	// Check if not enough arguments were provided
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting data from arguments failed
+	const tuple<uint8_t *, size_t, bool> data = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(data)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting single-signer signature from data failed
+	array<uint8_t, SINGLE_SIGNER_SIGNATURE_SIZE> signature;
+	if(!Secp256k1Zkp::singleSignerSignatureFromData(instanceData, signature.data(), get<0>(data), get<1>(data))) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return signature as a uint8 array
+	return bufferToUint8Array(environment, signature.data(), signature.size());
+}
+
+// Compact single-signer signature
+napi_value compactSingleSignerSignature(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment);
+	if(!instanceData) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+
+	// Check if not enough arguments were provided
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting signature from arguments failed
+	const tuple<uint8_t *, size_t, bool> signature = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(signature)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if compacting single-signer signature failed
+	array<uint8_t, SINGLE_SIGNER_SIGNATURE_SIZE> result;
+	if(!Secp256k1Zkp::compactSingleSignerSignature(instanceData, result.data(), get<0>(signature), get<1>(signature))) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return result as a uint8 array
+	return bufferToUint8Array(environment, result.data(),result.size());
+}
+
+// Uncompact single-signer signature
+napi_value uncompactSingleSignerSignature(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment);
+	if(!instanceData) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+
+	// Check if not enough arguments were provided
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting signature from arguments failed
+	const tuple<uint8_t *, size_t, bool> signature = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(signature)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if uncompacting single-signer signature failed
+	array<uint8_t, UNCOMPACT_SINGLE_SIGNER_SIGNATURE_SIZE> result;
+	if(!Secp256k1Zkp::uncompactSingleSignerSignature(instanceData, result.data(), get<0>(signature), get<1>(signature))) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return result as a uint8 array
+	return bufferToUint8Array(environment, result.data(), result.size());
+}
+
+// Combine public keys
+napi_value combinePublicKeys(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment);
+	if(!instanceData) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if not enough arguments were provided
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting number of public keys from arguments failed
+	bool isArray;
+	uint32_t numberOfPublicKeys;
+	if(napi_is_array(environment, argv[0], &isArray) != napi_ok || !isArray || napi_get_array_length(environment, argv[0], &numberOfPublicKeys) != napi_ok) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Initialize public keys and public keys sizes
+	vector<uint8_t> publicKeys;
+	vector<size_t> publicKeysSizes(numberOfPublicKeys);
+	
+	// Go through all public keys
+	for(uint32_t i = 0; i < numberOfPublicKeys; ++i) {
+	
+		// Check if getting public key failed
+		napi_value publicKey;
+		if(napi_get_element(environment, argv[0], i, &publicKey) != napi_ok) {
+		
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Check if getting public key as a buffer failed
+		const tuple<uint8_t *, size_t, bool> publicKeyBuffer = uint8ArrayToBuffer(environment, publicKey);
+		if(!get<2>(publicKeyBuffer)) {
+		
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Append public key buffer to public keys
+		publicKeys.insert(publicKeys.cend(), get<0>(publicKeyBuffer), get<0>(publicKeyBuffer) + get<1>(publicKeyBuffer));
+		
+		// Append public key's size to public keys sizes
+		publicKeysSizes[i] = get<1>(publicKeyBuffer);
+	}
+	
+	// Check if combining public keys failed
+	array<uint8_t, PUBLIC_KEY_SIZE> result;
+	if(!Secp256k1Zkp::combinePublicKeys(instanceData, result.data(), publicKeys.data(), publicKeysSizes.data(), numberOfPublicKeys)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return result as a uint8 array
+	return bufferToUint8Array(environment, result.data(), result.size());
+}
+
+// Multi-scalar multiply
+napi_value multiScalarMultiply(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment, VERIFY_CAPABILITY | SCRATCH_SPACE_CAPABILITY);
+	if(!instanceData) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if not enough arguments were provided
+	array<napi_value, 2> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting number of points from arguments failed
+	bool isArray;
+	uint32_t numberOfPoints;
+	if(napi_is_array(environment, argv[0], &isArray) != napi_ok || !isArray || napi_get_array_length(environment, argv[0], &numberOfPoints) != napi_ok) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting number of scalars from arguments failed or it's not the same as the number of points
+	uint32_t numberOfScalars;
+	if(napi_is_array(environment, argv[1], &isArray) != napi_ok || !isArray || napi_get_array_length(environment, argv[1], &numberOfScalars) != napi_ok || numberOfScalars != numberOfPoints) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if allocating scalars failed
+	vector<secp256k1_pubkey> points(numberOfPoints);
+	bool allPointsAreCommits = true;
+	uint8_t *scalars = secureAllocate(instanceData, numberOfScalars * SECRET_KEY_SIZE);
+	if(!scalars) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Go through all points and scalars
+	for(uint32_t i = 0; i < numberOfPoints; ++i) {
+	
+		// Check if getting point and scalar failed
+		napi_value point;
+		napi_value scalar;
+		if(napi_get_element(environment, argv[0], i, &point) != napi_ok || napi_get_element(environment, argv[1], i, &scalar) != napi_ok) {
+		
+			// Free scalars
+			secureFree(instanceData, scalars);
+			
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Check if getting point as a buffer failed
+		const tuple<uint8_t *, size_t, bool> pointBuffer = uint8ArrayToBuffer(environment, point);
+		if(!get<2>(pointBuffer)) {
+		
+			// Free scalars
+			secureFree(instanceData, scalars);
+			
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Check if point is a commit
+		if(get<1>(pointBuffer) == COMMIT_SIZE && (get<0>(pointBuffer)[0] & ~1) == COMMIT_EVEN_PREFIX) {
+		
+			// Check if getting the commit's public key failed or parsing it failed
+			array<uint8_t, PUBLIC_KEY_SIZE> publicKey;
+			if(!Secp256k1Zkp::pedersenCommitToPublicKey(instanceData, publicKey.data(), get<0>(pointBuffer), get<1>(pointBuffer)) || !secp256k1_ec_pubkey_parse(instanceData->context, &points[i], publicKey.data(), publicKey.size())) {
+			
+				// Free scalars
+				secureFree(instanceData, scalars);
+				
+				// Return operation failed
+				return operationFailed(environment);
+			}
+		}
+		
+		// Otherwise
+		else {
+		
+			// Clear all points are commits
+			allPointsAreCommits = false;
+			
+			// Check if parsing the point as a public key failed
+			if(!secp256k1_ec_pubkey_parse(instanceData->context, &points[i], get<0>(pointBuffer), get<1>(pointBuffer))) {
+			
+				// Free scalars
+				secureFree(instanceData, scalars);
+				
+				// Return operation failed
+				return operationFailed(environment);
+			}
+		}
+		
+		// Check if getting scalar as a buffer failed or it has an invalid size
+		const tuple<uint8_t *, size_t, bool> scalarBuffer = uint8ArrayToBuffer(environment, scalar);
+		if(!get<2>(scalarBuffer) || get<1>(scalarBuffer) != SECRET_KEY_SIZE) {
+		
+			// Free scalars
+			secureFree(instanceData, scalars);
+			
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Append scalar buffer to scalars
+		memcpy(&scalars[i * SECRET_KEY_SIZE], get<0>(scalarBuffer), get<1>(scalarBuffer));
+	}
+	
+	// Check if performing multi-scalar multiplication with the instance data's scratch space failed
+	secp256k1_pubkey result;
+	bool isInfinity;
+	if(!multiScalarMultiply(instanceData->context, instanceData->scratchSpace, &result, &isInfinity, points.data(), scalars, numberOfPoints)) {
+	
+		// Free scalars
+		secureFree(instanceData, scalars);
+		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Free scalars
+	secureFree(instanceData, scalars);
+	
+	// Check if result is infinity
+	if(isInfinity) {
+	
+		// Return point at infinity
+		return pointAtInfinity(environment);
+	}
+	
+	// Check if serializing result failed
+	array<uint8_t, PUBLIC_KEY_SIZE> publicKey;
+	size_t publicKeySize = publicKey.size();
+	if(!secp256k1_ec_pubkey_serialize(instanceData->context, publicKey.data(), &publicKeySize, &result, SECP256K1_EC_COMPRESSED)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if all points are commits
+	if(allPointsAreCommits) {
+	
+		// Check if getting result's commit failed
+		array<uint8_t, COMMIT_SIZE> commit;
+		if(!Secp256k1Zkp::publicKeyToPedersenCommit(instanceData, commit.data(), publicKey.data(), publicKey.size())) {
+		
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Return commit as a uint8 array
+		return bufferToUint8Array(environment, commit.data(), commit.size());
+	}
+	
+	// Return public key as a uint8 array
+	return bufferToUint8Array(environment, publicKey.data(), publicKey.size());
+}
+
+// Create signing session
+napi_value createSigningSession(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment);
+	if(!instanceData) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if not enough arguments were provided
+	array<napi_value, 3> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting message from arguments failed or it has an invalid size
+	const tuple<uint8_t *, size_t, bool> message = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(message) || get<1>(message) != SINGLE_SIGNER_MESSAGE_SIZE) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting public keys from arguments failed or no public keys were provided
+	const tuple<uint8_t *, size_t, bool> publicKeys = packedUint8ArrayToBuffer(environment, argv[1], PUBLIC_KEY_SIZE);
+	if(!get<2>(publicKeys) || !get<1>(publicKeys)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting public nonces from arguments failed or there's not one for each public key
+	const tuple<uint8_t *, size_t, bool> publicNonces = packedUint8ArrayToBuffer(environment, argv[2], PUBLIC_KEY_SIZE);
+	if(!get<2>(publicNonces) || get<1>(publicNonces) != get<1>(publicKeys)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if creating signing session failed
+	unique_ptr<SigningSession> signingSession(new(nothrow) SigningSession);
+	if(!signingSession) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Set signing session's message and public nonces
+	signingSession->message.assign(get<0>(message), get<0>(message) + get<1>(message));
+	signingSession->publicNonces.assign(get<0>(publicNonces), get<0>(publicNonces) + get<1>(publicNonces) * PUBLIC_KEY_SIZE);
+	
+	// Go through all public keys and public nonces
+	signingSession->publicKeys.resize(get<1>(publicKeys));
+	signingSession->parsedPublicNonces.resize(get<1>(publicNonces));
+	vector<const secp256k1_pubkey *> publicKeyPointers(get<1>(publicKeys));
+	vector<const secp256k1_pubkey *> publicNoncePointers(get<1>(publicNonces));
+	for(size_t i = 0; i < get<1>(publicKeys); ++i) {
+	
+		// Check if parsing public key or public nonce failed
+		if(!secp256k1_ec_pubkey_parse(instanceData->context, &signingSession->publicKeys[i], &get<0>(publicKeys)[i * PUBLIC_KEY_SIZE], PUBLIC_KEY_SIZE) || !secp256k1_ec_pubkey_parse(instanceData->context, &signingSession->parsedPublicNonces[i], &get<0>(publicNonces)[i * PUBLIC_KEY_SIZE], PUBLIC_KEY_SIZE)) {
+		
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Set public key and public nonce pointers
+		publicKeyPointers[i] = &signingSession->publicKeys[i];
+		publicNoncePointers[i] = &signingSession->parsedPublicNonces[i];
+	}
+	
+	// Check if combining public keys or public nonces into their totals failed
+	if(!secp256k1_ec_pubkey_combine(instanceData->context, &signingSession->publicKeyTotal, publicKeyPointers.data(), publicKeyPointers.size()) || !secp256k1_ec_pubkey_combine(instanceData->context, &signingSession->publicNonceTotal, publicNoncePointers.data(), publicNoncePointers.size())) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Set signing session's challenge from the totals and message
+	signingSession->challenge.resize(SECRET_KEY_SIZE);
+	singleSignerChallenge(instanceData->context, signingSession->challenge.data(), &signingSession->publicNonceTotal, &signingSession->publicKeyTotal, signingSession->message.data());
+	
+	// Check if creating signing session object failed
+	napi_value constructor;
+	napi_value result;
+	if(napi_get_reference_value(environment, instanceData->signingSessionConstructor, &constructor) != napi_ok || napi_new_instance(environment, constructor, 0, nullptr, &result) != napi_ok) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if associating signing session with the object failed
+	if(napi_wrap(environment, result, signingSession.get(), [](napi_env environment, void *finalizeData, void *finalizeHint) {
+	
+		// Free memory
+		delete reinterpret_cast<SigningSession *>(finalizeData);
+		
+	}, nullptr, nullptr) != napi_ok) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Release signing session since the object owns it
+	signingSession.release();
+	
+	// Check if tagging the object as a signing session failed
+	if(napi_type_tag_object(environment, result, &SIGNING_SESSION_TYPE_TAG) != napi_ok) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return result
+	return result;
+}
+
+// Signing session get public key total
+napi_value signingSessionGetPublicKeyTotal(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment);
+	if(!instanceData) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if arguments were provided
+	array<napi_value, 0> argv;
+	napi_value thisArgument;
+	if(!getArguments(environment, arguments, argv, &thisArgument)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting signing session failed
+	const tuple<SigningSession *, bool> signingSession = getSigningSession(environment, thisArgument);
+	if(!get<1>(signingSession)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return serializing signing session's public key total
+	return serializePublicKey(environment, instanceData, &get<0>(signingSession)->publicKeyTotal);
+}
+
+// Signing session get public nonce total
+napi_value signingSessionGetPublicNonceTotal(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment);
+	if(!instanceData) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if arguments were provided
+	array<napi_value, 0> argv;
+	napi_value thisArgument;
+	if(!getArguments(environment, arguments, argv, &thisArgument)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting signing session failed
+	const tuple<SigningSession *, bool> signingSession = getSigningSession(environment, thisArgument);
+	if(!get<1>(signingSession)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return serializing signing session's public nonce total
+	return serializePublicKey(environment, instanceData, &get<0>(signingSession)->publicNonceTotal);
+}
+
+// Signing session create partial signature
+napi_value signingSessionCreatePartialSignature(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment);
+	if(!instanceData) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if not enough arguments were provided
+	array<napi_value, 2> argv;
+	napi_value thisArgument;
+	if(!getArguments(environment, arguments, argv, &thisArgument)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting signing session failed
+	const tuple<SigningSession *, bool> signingSession = getSigningSession(environment, thisArgument);
+	if(!get<1>(signingSession)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting secret key from arguments failed or it has an invalid size
+	const tuple<uint8_t *, size_t, bool> secretKey = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(secretKey) || get<1>(secretKey) != SECRET_KEY_SIZE) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting secret nonce from arguments failed or it has an invalid size
+	const tuple<uint8_t *, size_t, bool> secretNonce = uint8ArrayToBuffer(environment, argv[1]);
+	if(!get<2>(secretNonce) || get<1>(secretNonce) != NONCE_SIZE) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if allocating seed failed
+	uint8_t *seed = secureAllocate(instanceData, SEED_SIZE);
+	if(!seed) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if creating random seed failed
+	if(!randomFill(environment, seed, SEED_SIZE)) {
+	
+		// Free seed
+		secureFree(instanceData, seed);
+		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if creating partial signature with the signing session's parsed totals failed
+	array<uint8_t, SINGLE_SIGNER_SIGNATURE_SIZE> signature;
+	if(!secp256k1_aggsig_sign_single(instanceData->context, signature.data(), get<0>(signingSession)->message.data(), get<0>(secretKey), get<0>(secretNonce), nullptr, &get<0>(signingSession)->publicNonceTotal, &get<0>(signingSession)->publicNonceTotal, &get<0>(signingSession)->publicKeyTotal, seed)) {
+	
+		// Free seed
+		secureFree(instanceData, seed);
+		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Free seed
+	secureFree(instanceData, seed);
+	
+	// Count signing operation
+	countSigningOperation(environment, instanceData);
+	
+	// Return signature as a uint8 array
+	return bufferToUint8Array(environment, signature.data(), signature.size());
+}
+
+// Signing session verify partial signature
+napi_value signingSessionVerifyPartialSignature(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment, VERIFY_CAPABILITY);
+	if(!instanceData) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if not enough arguments were provided
+	array<napi_value, 2> argv;
+	napi_value thisArgument;
+	if(!getArguments(environment, arguments, argv, &thisArgument)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting signing session failed
+	const tuple<SigningSession *, bool> signingSession = getSigningSession(environment, thisArgument);
+	if(!get<1>(signingSession)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting signature from arguments failed or it has an invalid size
+	const tuple<uint8_t *, size_t, bool> signature = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(signature) || get<1>(signature) != SINGLE_SIGNER_SIGNATURE_SIZE) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting participant index from arguments failed or it's invalid
+	uint32_t participantIndex;
+	if(napi_get_value_uint32(environment, argv[1], &participantIndex) != napi_ok || participantIndex >= get<0>(signingSession)->publicKeys.size()) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if signature isn't a valid partial signature for the participant's public key and public nonce with the signing session's challenge and public nonce total
+	if(!verifyPartialSingleSignerSignature(instanceData->context, get<0>(signature), get<0>(signingSession)->challenge.data(), &get<0>(signingSession)->publicKeys[participantIndex], &get<0>(signingSession)->parsedPublicNonces[participantIndex], &get<0>(signingSession)->publicNonceTotal)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Return true as a bool
+	return cBoolToBool(environment, true);
+}
+
+// Signing session verify partial signatures
+napi_value signingSessionVerifyPartialSignatures(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment, VERIFY_CAPABILITY | SCRATCH_SPACE_CAPABILITY);
+	if(!instanceData) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if not enough arguments were provided
+	array<napi_value, 1> argv;
+	napi_value thisArgument;
+	if(!getArguments(environment, arguments, argv, &thisArgument)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting signing session failed
+	const tuple<SigningSession *, bool> signingSession = getSigningSession(environment, thisArgument);
+	if(!get<1>(signingSession)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting partial signatures from arguments failed or there's not one for each participant
+	const tuple<uint8_t *, size_t, bool> partialSignatures = packedUint8ArrayToBuffer(environment, argv[0], SINGLE_SIGNER_SIGNATURE_SIZE);
+	if(!get<2>(partialSignatures) || get<1>(partialSignatures) != get<0>(signingSession)->publicKeys.size()) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if creating random weights seed failed
+	array<uint8_t, RANDOM_WEIGHTS_SEED_SIZE> seed;
+	if(!randomFill(environment, seed.data(), seed.size())) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Initialize failed participant index
+	int32_t failedParticipantIndex = -1;
+	
+	// Check if all partial signatures aren't valid when verified together in one randomly weighted multi-scalar multiplication
+	if(!verifyPartialSingleSignerSignatures(instanceData->context, instanceData->scratchSpace, get<0>(partialSignatures), get<1>(partialSignatures), get<0>(signingSession)->challenge.data(), get<0>(signingSession)->publicKeys.data(), get<0>(signingSession)->parsedPublicNonces.data(), &get<0>(signingSession)->publicNonceTotal, seed.data())) {
+	
+		// Go through all partial signatures
+		for(size_t i = 0; i < get<1>(partialSignatures); ++i) {
+		
+			// Check if partial signature isn't a valid partial signature for the participant's public key and public nonce using the same equation as the batch verification
+			if(!verifyPartialSingleSignerSignature(instanceData->context, &get<0>(partialSignatures)[i * SINGLE_SIGNER_SIGNATURE_SIZE], get<0>(signingSession)->challenge.data(), &get<0>(signingSession)->publicKeys[i], &get<0>(signingSession)->parsedPublicNonces[i], &get<0>(signingSession)->publicNonceTotal)) {
+			
+				// Set failed participant index
+				failedParticipantIndex = i;
+				
+				// Break
+				break;
+			}
+		}
+		
+		// Check if no partial signature failed by itself which means that the batch verification failed for another reason like running out of memory
+		if(failedParticipantIndex == -1) {
+		
+			// Return operation failed
+			return operationFailed(environment);
+		}
+	}
+	
+	// Check if creating result from the failed participant index failed
+	napi_value result;
+	if(napi_create_int32(environment, failedParticipantIndex, &result) != napi_ok) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return result
+	return result;
+}
+
+// Signing session add partial signatures
+napi_value signingSessionAddPartialSignatures(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment);
+	if(!instanceData) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if not enough arguments were provided
+	array<napi_value, 1> argv;
+	napi_value thisArgument;
+	if(!getArguments(environment, arguments, argv, &thisArgument)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting signing session failed
+	const tuple<SigningSession *, bool> signingSession = getSigningSession(environment, thisArgument);
+	if(!get<1>(signingSession)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting partial signatures from arguments failed or there's not one for each participant
+	const tuple<uint8_t *, size_t, bool> partialSignatures = packedUint8ArrayToBuffer(environment, argv[0], SINGLE_SIGNER_SIGNATURE_SIZE);
+	if(!get<2>(partialSignatures) || get<1>(partialSignatures) != get<0>(signingSession)->publicKeys.size()) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Go through all partial signatures
+	vector<const uint8_t *> partialSignaturePointers(get<1>(partialSignatures));
+	for(size_t i = 0; i < partialSignaturePointers.size(); ++i) {
+	
+		// Set partial signature pointer
+		partialSignaturePointers[i] = &get<0>(partialSignatures)[i * SINGLE_SIGNER_SIGNATURE_SIZE];
+	}
+	
+	// Check if adding partial signatures with the signing session's public nonce total failed
+	array<uint8_t, SINGLE_SIGNER_SIGNATURE_SIZE> signature;
+	if(!secp256k1_aggsig_add_signatures_single(instanceData->context, signature.data(), partialSignaturePointers.data(), partialSignaturePointers.size(), &get<0>(signingSession)->publicNonceTotal)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return signature as a uint8 array
+	return bufferToUint8Array(environment, signature.data(), signature.size());
+}
+
+// Signing session verify signature
+napi_value signingSessionVerifySignature(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment, VERIFY_CAPABILITY);
+	if(!instanceData) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if not enough arguments were provided
+	array<napi_value, 1> argv;
+	napi_value thisArgument;
+	if(!getArguments(environment, arguments, argv, &thisArgument)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting signing session failed
+	const tuple<SigningSession *, bool> signingSession = getSigningSession(environment, thisArgument);
+	if(!get<1>(signingSession)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting signature from arguments failed or it has an invalid size
+	const tuple<uint8_t *, size_t, bool> signature = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(signature) || get<1>(signature) != SINGLE_SIGNER_SIGNATURE_SIZE) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if signature isn't valid for the signing session's message and totals
+	if(!secp256k1_aggsig_verify_single(instanceData->context, get<0>(signature), get<0>(signingSession)->message.data(), &get<0>(signingSession)->publicNonceTotal, &get<0>(signingSession)->publicKeyTotal, &get<0>(signingSession)->publicKeyTotal, nullptr, false)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Return true as a bool
+	return cBoolToBool(environment, true);
+}
+
+// Rerandomize context
+napi_value rerandomizeContext(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment);
+	if(!instanceData) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if arguments were provided
+	array<napi_value, 0> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if randomizing instance data's context failed
+	if(!randomizeContext(environment, instanceData)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Return true as a bool
+	return cBoolToBool(environment, true);
+}
+
+// Set context randomization interval
+napi_value setContextRandomizationInterval(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment);
+	if(!instanceData) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if not enough arguments were provided
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting interval from arguments failed
+	uint32_t interval;
+	if(napi_get_value_uint32(environment, argv[0], &interval) != napi_ok) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Set instance data's context randomization interval
+	instanceData->contextRandomizationInterval = interval;
+	
+	// Return true as a bool
+	return cBoolToBool(environment, true);
+}
+
+// Get memory usage
+napi_value getMemoryUsage(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data without creating anything failed
+	InstanceData *instanceData;
+	if(napi_get_instance_data(environment, reinterpret_cast<void **>(&instanceData)) != napi_ok) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if arguments were provided
+	array<napi_value, 0> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Update external memory
+	updateExternalMemory(environment, instanceData);
+	
+	// Check if creating result failed
+	napi_value result;
+	if(napi_create_object(environment, &result) != napi_ok) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Go through all memory usages
+	const tuple<size_t, size_t, size_t, size_t, size_t, size_t> memoryUsage = getInstanceMemoryUsage(instanceData);
+	const array<tuple<const char *, size_t>, 7> memoryUsages = {{
+		{"Context", get<0>(memoryUsage)},
+		{"ScratchSpace", get<1>(memoryUsage)},
+		{"Generators", get<2>(memoryUsage)},
+		{"SecureArena", get<3>(memoryUsage)},
+		{"ProofCache", get<4>(memoryUsage)},
+		{"SignatureCache", get<5>(memoryUsage)},
+		{"Total", get<0>(memoryUsage) + get<1>(memoryUsage) + get<2>(memoryUsage) + get<3>(memoryUsage) + get<4>(memoryUsage) + get<5>(memoryUsage)}
+	}};
+	for(const tuple<const char *, size_t> &usage : memoryUsages) {
+	
+		// Check if adding memory usage to the result failed
+		napi_value temp;
+		if(napi_create_int64(environment, get<1>(usage), &temp) != napi_ok || napi_set_named_property(environment, result, get<0>(usage), temp) != napi_ok) {
+		
+			// Return operation failed
+			return operationFailed(environment);
+		}
+	}
+	
+	// Return result
+	return result;
+}
+
+// Set scheduler threads
+napi_value setSchedulerThreads(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData;
+	if(napi_get_instance_data(environment, reinterpret_cast<void **>(&instanceData)) != napi_ok) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if not enough arguments were provided
+	array<napi_value, 2> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting number of interactive threads and bulk threads from arguments failed or either is zero
+	uint32_t numberOfInteractiveThreads;
+	uint32_t numberOfBulkThreads;
+	if(napi_get_value_uint32(environment, argv[0], &numberOfInteractiveThreads) != napi_ok || napi_get_value_uint32(environment, argv[1], &numberOfBulkThreads) != napi_ok || !numberOfInteractiveThreads || !numberOfBulkThreads) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting the scheduler failed
+	Scheduler *scheduler = getScheduler();
+	if(!scheduler) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if the scheduler's threads have already been started by any instance since they're shared by the whole process
+	lock_guard<mutex> lock(scheduler->lock);
+	if(!scheduler->threads.empty()) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Set the scheduler's number of threads
+	scheduler->numberOfThreads[INTERACTIVE_PRIORITY] = numberOfInteractiveThreads;
+	scheduler->numberOfThreads[BULK_PRIORITY] = numberOfBulkThreads;
+	
+	// Return true as a bool
+	return cBoolToBool(environment, true);
+}
+
+// Set proof cache capacity
+napi_value setProofCacheCapacity(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData;
+	if(napi_get_instance_data(environment, reinterpret_cast<void **>(&instanceData)) != napi_ok) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if not enough arguments were provided
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting capacity from arguments failed
+	uint32_t capacity;
+	if(napi_get_value_uint32(environment, argv[0], &capacity) != napi_ok) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if setting instance data's proof cache's capacity failed
+	if(!configureVerificationCache(environment, &instanceData->proofCache, instanceData->proofCache.enabled, capacity)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Update external memory
+	updateExternalMemory(environment, instanceData);
+	
+	// Return true as a bool
+	return cBoolToBool(environment, true);
+}
+
+// Get proof cache statistics
+napi_value getProofCacheStatistics(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData;
+	if(napi_get_instance_data(environment, reinterpret_cast<void **>(&instanceData)) != napi_ok) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if arguments were provided
+	array<napi_value, 0> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return getting instance data's proof cache's statistics
+	return getVerificationCacheStatistics(environment, &instanceData->proofCache);
+}
+
+// Set signature cache size
+napi_value setSignatureCacheSize(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData;
+	if(napi_get_instance_data(environment, reinterpret_cast<void **>(&instanceData)) != napi_ok) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if not enough arguments were provided
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting size from arguments failed
+	int64_t size;
+	if(napi_get_value_int64(environment, argv[0], &size) != napi_ok || size < 0) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if setting instance data's signature cache's capacity to the number of entries that fit in the size failed
+	if(!configureVerificationCache(environment, &instanceData->signatureCache, instanceData->signatureCache.enabled, static_cast<uint64_t>(size) / VERIFICATION_CACHE_ENTRY_MEMORY_USAGE)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Update external memory
+	updateExternalMemory(environment, instanceData);
+	
+	// Return true as a bool
+	return cBoolToBool(environment, true);
+}
+
+// Set signature cache enabled
+napi_value setSignatureCacheEnabled(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData;
+	if(napi_get_instance_data(environment, reinterpret_cast<void **>(&instanceData)) != napi_ok) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if not enough arguments were provided
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting enabled from arguments failed
+	bool enabled;
+	if(napi_get_value_bool(environment, argv[0], &enabled) != napi_ok) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if setting instance data's signature cache's enabled failed
+	if(!configureVerificationCache(environment, &instanceData->signatureCache, enabled, instanceData->signatureCache.capacity)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Update external memory
+	updateExternalMemory(environment, instanceData);
+	
+	// Return true as a bool
+	return cBoolToBool(environment, true);
+}
+
+// Get signature cache statistics
+napi_value getSignatureCacheStatistics(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData;
+	if(napi_get_instance_data(environment, reinterpret_cast<void **>(&instanceData)) != napi_ok) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if arguments were provided
+	array<napi_value, 0> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return getting instance data's signature cache's statistics
+	return getVerificationCacheStatistics(environment, &instanceData->signatureCache);
+}
+
+// Create secret nonce
+napi_value createSecretNonce(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment);
+	if(!instanceData) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+
+	// Check if arguments were provided
+	size_t argc = 0;
+	if(napi_get_cb_info(environment, arguments, &argc, nullptr, nullptr, nullptr) != napi_ok || argc) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if allocating seed and nonce failed
+	uint8_t *seed = secureAllocate(instanceData, SEED_SIZE);
+	uint8_t *nonce = secureAllocate(instanceData, NONCE_SIZE);
+	if(!seed || !nonce) {
+	
+		// Check if seed was allocated
+		if(seed) {
+		
+			// Free seed
+			secureFree(instanceData, seed);
+		}
+		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if creating random seed failed
+	if(!randomFill(environment, seed, SEED_SIZE)) {
+	
+		// Free seed and nonce
+		secureFree(instanceData, seed);
+		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if creating secure nonce failed
+	if(!Secp256k1Zkp::createSecretNonce(instanceData, nonce, seed, SEED_SIZE)) {
+	
+		// Free seed and nonce
+		secureFree(instanceData, seed);
+		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Get nonce as a uint8 array
+	const napi_value uint8ArrayNonce = bufferToUint8Array(environment, nonce, NONCE_SIZE);
+	
+	// Free seed and nonce
+	secureFree(instanceData, seed);
+	
+	// Return nonce as a uint8 array
+	return uint8ArrayNonce;
+}
+
+// Create message hash signature
+napi_value createMessageHashSignature(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment);
+	if(!instanceData) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+
+	// Check if not enough arguments were provided
+	array<napi_value, 2> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting message hash from arguments failed
+	const tuple<uint8_t *, size_t, bool> messageHash = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(messageHash)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting secret key from arguments failed
+	const tuple<uint8_t *, size_t, bool> secretKey = uint8ArrayToBuffer(environment, argv[1]);
+	if(!get<2>(secretKey)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if creating message hash signature failed
+	array<uint8_t, MESSAGE_HASH_SIGNATURE_MAXIMUM_SIZE> signature;
+	char signatureSize[MAX_64_BIT_INTEGER_STRING_LENGTH];
+	if(!Secp256k1Zkp::createMessageHashSignature(instanceData, signature.data(), signatureSize, get<0>(messageHash), get<1>(messageHash), get<0>(secretKey), get<1>(secretKey))) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Count signing operation
+	countSigningOperation(environment, instanceData);
+	
+	// Return signature as a uint8 array
+	return bufferToUint8Array(environment, signature.data(), strtoull(signatureSize, nullptr, 10));
+}
+
+// Verify message hash signature
+napi_value verifyMessageHashSignature(napi_env environment, napi_callback_info arguments) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment, VERIFY_CAPABILITY);
+	if(!instanceData) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+
+	// Check if not enough arguments were provided
+	array<napi_value, 3> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting signature from arguments failed
+	const tuple<uint8_t *, size_t, bool> signature = uint8ArrayToBuffer(environment, argv[0]);
+	if(!get<2>(signature)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting message hash from arguments failed
+	const tuple<uint8_t *, size_t, bool> messageHash = uint8ArrayToBuffer(environment, argv[1]);
+	if(!get<2>(messageHash)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if getting public key from arguments failed
+	const tuple<uint8_t *, size_t, bool> publicKey = uint8ArrayToBuffer(environment, argv[2]);
+	if(!get<2>(publicKey)) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if message hash signature was already verified
+	string signatureCacheKey;
+	if(verificationCacheContains(&instanceData->signatureCache, signatureCacheKey, {{&MESSAGE_HASH_SIGNATURE_CACHE_TAG, sizeof(MESSAGE_HASH_SIGNATURE_CACHE_TAG)}, {get<0>(signature), get<1>(signature)}, {get<0>(messageHash), get<1>(messageHash)}, {get<0>(publicKey), get<1>(publicKey)}})) {
+	
+		// Return true as a bool
+		return cBoolToBool(environment, true);
+	}
+	
+	// Check if message hash signature isn't verified
+	if(!Secp256k1Zkp::verifyMessageHashSignature(instanceData, get<0>(signature), get<1>(signature), get<0>(messageHash), get<1>(messageHash), get<0>(publicKey), get<1>(publicKey))) {
+	
+		// Return false as a bool
+		return cBoolToBool(environment, false);
+	}
+	
+	// Check if message hash signature was added to the signature cache as a new entry
+	if(verificationCacheAdd(&instanceData->signatureCache, signatureCacheKey)) {
+	
+		// Update external memory
+		updateExternalMemory(environment, instanceData);
+	}
+	
+	// Return true as a bool
+	return cBoolToBool(environment, true);
+}
+
+// Get signing session
+tuple<SigningSession *, bool> getSigningSession(napi_env environment, napi_value thisArgument) {
+
+	// Check if this isn't tagged as a signing session
+	bool isSigningSession;
+	if(napi_check_object_type_tag(environment, thisArgument, &SIGNING_SESSION_TYPE_TAG, &isSigningSession) != napi_ok || !isSigningSession) {
+	
+		// Throw type error
+		napi_throw_type_error(environment, nullptr, "Invalid signing session");
+		
+		// Return failure
+		return {nullptr, false};
+	}
+	
+	// Check if getting signing session from this failed
+	SigningSession *signingSession;
+	if(napi_unwrap(environment, thisArgument, reinterpret_cast<void **>(&signingSession)) != napi_ok) {
+	
+		// Return failure
+		return {nullptr, false};
+	}
+	
+	// Return signing session
+	return {signingSession, true};
+}
+
+// Serialize public key
+napi_value serializePublicKey(napi_env environment, InstanceData *instanceData, const secp256k1_pubkey *publicKey) {
+
+	// Check if serializing public key failed
+	array<uint8_t, PUBLIC_KEY_SIZE> serializedPublicKey;
+	size_t serializedPublicKeySize = serializedPublicKey.size();
+	if(!secp256k1_ec_pubkey_serialize(instanceData->context, serializedPublicKey.data(), &serializedPublicKeySize, publicKey, SECP256K1_EC_COMPRESSED)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return serialized public key as a uint8 array
+	return bufferToUint8Array(environment, serializedPublicKey.data(), serializedPublicKey.size());
+}
+
+// Perform batch format check
+napi_value performBatchFormatCheck(napi_env environment, napi_callback_info arguments, size_t itemSize, const function<void(const uint8_t *items, size_t numberOfItems, bool *results)> &areValid) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData;
+	if(napi_get_instance_data(environment, reinterpret_cast<void **>(&instanceData)) != napi_ok) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if not enough arguments were provided
+	array<napi_value, 1> argv;
+	if(!getArguments(environment, arguments, argv)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting items from arguments failed
+	const tuple<uint8_t *, size_t, bool> items = packedUint8ArrayToBuffer(environment, argv[0], itemSize);
+	if(!get<2>(items)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Go through all batches of items in parallel, each batch covering whole bytes of the results
+	vector<uint8_t> results((get<1>(items) + 8 - 1) / 8, 0);
+	runInParallel(instanceData, INTERACTIVE_PRIORITY, nullptr, get<1>(items), FORMAT_CHECKS_PER_BATCH, [&items, itemSize, &areValid, &results](size_t start, size_t end, secp256k1_scratch_space *scratchSpace) -> bool {
+	
+		// Check if the items in the batch are valid together
+		array<bool, FORMAT_CHECKS_PER_BATCH> batchResults;
+		areValid(&get<0>(items)[start * itemSize], end - start, batchResults.data());
+		
+		// Go through all items in the batch
+		for(size_t i = start; i < end; ++i) {
+		
+			// Check if item is valid
+			if(batchResults[i - start]) {
+			
+				// Set item's bit in the results
+				results[i / 8] |= 1 << (i % 8);
+			}
+		}
+		
+		// Return true
+		return true;
+	});
+	
+	// Return results as a uint8 array
+	return bufferToUint8Array(environment, results.data(), results.size());
+}
+
+// Get rewind context
+tuple<RewindContext *, bool> getRewindContext(napi_env environment, napi_value thisArgument) {
+
+	// Check if this isn't tagged as a rewind context
+	bool isRewindContext;
+	if(napi_check_object_type_tag(environment, thisArgument, &REWIND_CONTEXT_TYPE_TAG, &isRewindContext) != napi_ok || !isRewindContext) {
+	
+		// Throw type error
+		napi_throw_type_error(environment, nullptr, "Invalid rewind context");
+		
+		// Return failure
+		return {nullptr, false};
+	}
+	
+	// Check if getting rewind context from this failed
+	RewindContext *rewindContext;
+	if(napi_unwrap(environment, thisArgument, reinterpret_cast<void **>(&rewindContext)) != napi_ok) {
+	
+		// Return failure
+		return {nullptr, false};
+	}
+	
+	// Return rewind context
+	return {rewindContext, true};
+}
+
+// Rewind bulletproof with cache
+bool rewindBulletproofWithCache(const secp256k1_context *context, const BulletproofRewindCache *cache, char *value, uint8_t *blind, uint8_t *message, const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize) {
+
+	// Check if rewinding bulletproof with the cache's nonce derived values failed
+	uint64_t rewoundValue;
+	if(!bulletproofRewindCacheRewind(context, cache, &rewoundValue, blind, message, proof, proofSize, commit, commitSize)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Set value to the rewound value as a string
+	snprintf(value, MAX_64_BIT_INTEGER_STRING_LENGTH, "%" PRIu64, rewoundValue);
+	
+	// Return true
+	return true;
+}
+
+// Perform rewind bulletproof
+napi_value performRewindBulletproof(napi_env environment, InstanceData *instanceData, const function<bool(char *value, uint8_t *blind, uint8_t *message)> &rewind) {
+
+	// Check if allocating blind and message failed
+	uint8_t *blind = secureAllocate(instanceData, BLIND_SIZE);
+	uint8_t *message = secureAllocate(instanceData, BULLETPROOF_MESSAGE_SIZE);
+	if(!blind || !message) {
+	
+		// Check if blind was allocated
+		if(blind) {
+		
+			// Free blind
+			secureFree(instanceData, blind);
+		}
+		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if performing rewind bulletproof failed
+	char value[MAX_64_BIT_INTEGER_STRING_LENGTH];
+	if(!rewind(value, blind, message)) {
+	
+		// Free blind and message
+		secureFree(instanceData, blind);
+		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if creating result failed
+	napi_value result;
+	if(napi_create_object(environment, &result) != napi_ok) {
+	
+		// Free blind and message
+		secureFree(instanceData, blind);
+		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if adding value to result failed
+	napi_value temp;
+	if(napi_create_string_utf8(environment, value, NAPI_AUTO_LENGTH, &temp) != napi_ok || napi_set_named_property(environment, result, "Value", temp) != napi_ok) {
+	
+		// Free blind and message
+		secureFree(instanceData, blind);
+		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if adding blind to result failed
+	const napi_value uint8ArrayBlind = bufferToUint8Array(environment, blind, BLIND_SIZE);
+	if(isNull(environment, uint8ArrayBlind) || napi_set_named_property(environment, result, "Blind", uint8ArrayBlind) != napi_ok) {
+	
+		// Free blind and message
+		secureFree(instanceData, blind);
+		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if adding message to result failed
+	const napi_value uint8ArrayMessage = bufferToUint8Array(environment, message, BULLETPROOF_MESSAGE_SIZE);
+	if(isNull(environment, uint8ArrayMessage) || napi_set_named_property(environment, result, "Message", uint8ArrayMessage) != napi_ok) {
+	
+		// Free blind and message
+		secureFree(instanceData, blind);
+		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Free blind and message
+	secureFree(instanceData, blind);
+	
+	// Return result
+	return result;
+}
+
+// Perform validation
+napi_value performValidation(napi_env environment, napi_callback_info arguments, const char *name, bool isBlock) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData = getInstanceData(environment, VERIFY_CAPABILITY | GENERATORS_CAPABILITY);
+	if(!instanceData) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if not enough arguments were provided
+	array<napi_value, 10> argv;
+	if(!getArguments(environment, arguments, argv, nullptr, 2)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting inputs from arguments failed
+	const tuple<uint8_t *, size_t, bool> inputs = packedUint8ArrayToBuffer(environment, argv[0], COMMIT_SIZE);
+	if(!get<2>(inputs)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting outputs from arguments failed
+	const tuple<uint8_t *, size_t, bool> outputs = packedUint8ArrayToBuffer(environment, argv[1], COMMIT_SIZE);
+	if(!get<2>(outputs)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting number of proofs from arguments failed or it's not the same as the number of outputs
+	bool isArray;
+	uint32_t numberOfProofs;
+	if(napi_is_array(environment, argv[2], &isArray) != napi_ok || !isArray || napi_get_array_length(environment, argv[2], &numberOfProofs) != napi_ok || numberOfProofs != get<1>(outputs)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting kernel excesses from arguments failed
+	const tuple<uint8_t *, size_t, bool> kernelExcesses = packedUint8ArrayToBuffer(environment, argv[3], COMMIT_SIZE);
+	if(!get<2>(kernelExcesses)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting kernel signatures from arguments failed or there's not one for each kernel excess
+	const tuple<uint8_t *, size_t, bool> kernelSignatures = packedUint8ArrayToBuffer(environment, argv[4], SINGLE_SIGNER_SIGNATURE_SIZE);
+	if(!get<2>(kernelSignatures) || get<1>(kernelSignatures) != get<1>(kernelExcesses)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting kernel messages from arguments failed or there's not one for each kernel excess
+	const tuple<uint8_t *, size_t, bool> kernelMessages = packedUint8ArrayToBuffer(environment, argv[5], SINGLE_SIGNER_MESSAGE_SIZE);
+	if(!get<2>(kernelMessages) || get<1>(kernelMessages) != get<1>(kernelExcesses)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting kernel offset from arguments failed or it has an invalid size
+	const tuple<uint8_t *, size_t, bool> kernelOffset = uint8ArrayToBuffer(environment, argv[6]);
+	if(!get<2>(kernelOffset) || get<1>(kernelOffset) != BLIND_SIZE) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting the block's reward or the transaction's fee from arguments failed
+	uint64_t overage;
+	if(!stringToUint64(environment, argv[7], overage)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if creating task failed
+	shared_ptr<ValidateBlockTask> task(new(nothrow) ValidateBlockTask);
+	if(!task) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Set task's inputs, outputs, and kernels
+	task->inputs.assign(get<0>(inputs), get<0>(inputs) + get<1>(inputs) * COMMIT_SIZE);
+	task->outputs.assign(get<0>(outputs), get<0>(outputs) + get<1>(outputs) * COMMIT_SIZE);
+	task->kernelExcesses.assign(get<0>(kernelExcesses), get<0>(kernelExcesses) + get<1>(kernelExcesses) * COMMIT_SIZE);
+	task->kernelSignatures.assign(get<0>(kernelSignatures), get<0>(kernelSignatures) + get<1>(kernelSignatures) * SINGLE_SIGNER_SIGNATURE_SIZE);
+	task->kernelMessages.assign(get<0>(kernelMessages), get<0>(kernelMessages) + get<1>(kernelMessages) * SINGLE_SIGNER_MESSAGE_SIZE);
+	task->kernelOffset.assign(get<0>(kernelOffset), get<0>(kernelOffset) + get<1>(kernelOffset));
+	task->reward = isBlock ? overage : 0;
+	task->fee = isBlock ? 0 : overage;
+	task->result = false;
+	
+	// Check if creating the random weights seed for verifying the kernels' signatures together failed
+	task->kernelWeightsSeed.resize(RANDOM_WEIGHTS_SEED_SIZE);
+	if(!randomFill(environment, task->kernelWeightsSeed.data(), task->kernelWeightsSeed.size())) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Go through all proofs
+	task->proofs.resize(numberOfProofs);
+	for(uint32_t i = 0; i < numberOfProofs; ++i) {
+	
+		// Check if getting proof failed
+		napi_value proof;
+		if(napi_get_element(environment, argv[2], i, &proof) != napi_ok) {
+		
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Check if getting proof as a buffer failed
+		const tuple<uint8_t *, size_t, bool> proofBuffer = uint8ArrayToBuffer(environment, proof);
+		if(!get<2>(proofBuffer)) {
+		
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Set task's proof to the proof buffer
+		task->proofs[i].assign(get<0>(proofBuffer), get<0>(proofBuffer) + get<1>(proofBuffer));
+	}
+	
+	// Check if getting progress callback's type from arguments failed or it's not a function or not provided
+	napi_valuetype progressType;
+	if(napi_typeof(environment, argv[9], &progressType) != napi_ok || (progressType != napi_function && progressType != napi_undefined)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if getting abort signal from arguments failed
+	if(!getAbortSignal(environment, argv[8], task->abortSignal)) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Return queueing streaming task
+	const bool reportProgress = progressType == napi_function;
+	return queueStreamingAsyncTask(environment, name, reportProgress ? argv[9] : nullptr, BULK_PRIORITY, task->abortSignal.aborted, [instanceData, task, reportProgress](napi_threadsafe_function callback) {
+	
+		// Set task's result to if the block or transaction is valid
+		task->result = validateBlockTaskExecute(instanceData, *task, reportProgress ? callback : nullptr);
+		
+	}, [task](napi_env environment) -> napi_value {
+	
+		// Release task's abort signal
+		releaseAbortSignal(environment, task->abortSignal);
+		
+		// Check if task was aborted
+		if(*task->abortSignal.aborted) {
+		
+			// Return operation failed
+			return operationFailed(environment);
+		}
+		
+		// Return task's result as a bool
+		return cBoolToBool(environment, task->result);
+	});
+}
+
+// Validate block task execute
+bool validateBlockTaskExecute(InstanceData *instanceData, const ValidateBlockTask &task, napi_threadsafe_function callback) {
+
+	// Get instance data's context once so that the whole validation uses the same context
+	const secp256k1_context *context = instanceData->context;
+	
+	// Get number of inputs, outputs, and kernels
+	const size_t numberOfInputs = task.inputs.size() / COMMIT_SIZE;
+	const size_t numberOfOutputs = task.outputs.size() / COMMIT_SIZE;
+	const size_t numberOfKernels = task.kernelExcesses.size() / COMMIT_SIZE;
+	
+	// Get the total number of items to process which is every commit parsed, every proof verified, and every kernel verified
+	const size_t total = numberOfInputs + numberOfOutputs * 2 + numberOfKernels * 2;
+	atomic<size_t> processed(0);
+	
+	// Report progress
+	const function<void(size_t count)> reportProgress = [callback, &task, total, &processed](size_t count) {
+	
+		// Check if progress is reported
+		if(callback) {
+		
+			// Check if the batch crossed a progress interval or finished all the items
+			const size_t current = processed.fetch_add(count) + count;
+			if(current / VALIDATION_PROGRESS_INTERVAL != (current - count) / VALIDATION_PROGRESS_INTERVAL || current == total) {
+			
+				// Stream progress which is only informational so failing to deliver it doesn't fail the validation
+				streamEvent(callback, task.abortSignal.aborted.get(), [current, total](napi_env environment, napi_value callback) {
+				
+					// Check if environment exists
+					if(environment) {
+					
+						// Check if getting the number of items processed, the total number of items, and undefined was successful
+						array<napi_value, 2> callbackArguments;
+						napi_value undefined;
+						if(napi_create_double(environment, current, &callbackArguments[0]) == napi_ok && napi_create_double(environment, total, &callbackArguments[1]) == napi_ok && napi_get_undefined(environment, &undefined) == napi_ok) {
+						
+							// Call callback with the number of items processed and the total number of items
+							napi_call_function(environment, undefined, callback, callbackArguments.size(), callbackArguments.data(), nullptr);
+						}
+					}
+				});
+			}
+		}
+	};
+	
+	// Check if parsing the inputs, outputs, and kernel excesses failed
+	vector<secp256k1_pedersen_commitment> commitments(numberOfInputs + numberOfOutputs + numberOfKernels);
+	if(!runInParallel(instanceData, BULK_PRIORITY, nullptr, commitments.size(), COMMITS_PER_BATCH, [context, &task, &commitments, numberOfInputs, numberOfOutputs, &reportProgress](size_t start, size_t end, secp256k1_scratch_space *scratchSpace) -> bool {
+	
+		// Go through all commits in the batch
+		for(size_t i = start; i < end; ++i) {
+		
+			// Check if commit is an input
+			const uint8_t *commit;
+			if(i < numberOfInputs) {
+			
+				// Set commit to the input
+				commit = &task.inputs[i * COMMIT_SIZE];
+			}
+			
+			// Otherwise check if commit is an output
+			else if(i < numberOfInputs + numberOfOutputs) {
+			
+				// Set commit to the output
+				commit = &task.outputs[(i - numberOfInputs) * COMMIT_SIZE];
+			}
+			
+			// Otherwise
+			else {
+			
+				// Set commit to the kernel excess
+				commit = &task.kernelExcesses[(i - numberOfInputs - numberOfOutputs) * COMMIT_SIZE];
+			}
+			
+			// Check if parsing commit failed
+			if(!secp256k1_pedersen_commitment_parse(context, &commitments[i], commit)) {
+			
+				// Return false
+				return false;
+			}
+		}
+		
+		// Report progress
+		reportProgress(end - start);
+		
+		// Return true
+		return true;
+	}, task.abortSignal.aborted.get())) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Go through all outputs
+	vector<const secp256k1_pedersen_commitment *> positiveCommitments(numberOfOutputs);
+	for(size_t i = 0; i < numberOfOutputs; ++i) {
+	
+		// Add output to the positive commitments
+		positiveCommitments[i] = &commitments[numberOfInputs + i];
+	}
+	
+	// Go through all inputs and kernel excesses
+	vector<const secp256k1_pedersen_commitment *> negativeCommitments;
+	negativeCommitments.reserve(numberOfInputs + numberOfKernels);
+	for(size_t i = 0; i < numberOfInputs; ++i) {
+	
+		// Add input to the negative commitments
+		negativeCommitments.push_back(&commitments[i]);
+	}
+	for(size_t i = 0; i < numberOfKernels; ++i) {
+	
+		// Add kernel excess to the negative commitments
+		negativeCommitments.push_back(&commitments[numberOfInputs + numberOfOutputs + i]);
+	}
+	
+	// Check if block has a reward
+	static const uint8_t zeroBlind[BLIND_SIZE] = {};
+	secp256k1_pedersen_commitment rewardCommitment;
+	if(task.reward) {
+	
+		// Check if committing to the reward with a zero blind failed
+		if(!secp256k1_pedersen_commit(context, &rewardCommitment, zeroBlind, task.reward, &secp256k1_generator_const_h, &secp256k1_generator_const_g)) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Add reward commitment to the negative commitments since it's a negative overage that's spent like an input
+		negativeCommitments.push_back(&rewardCommitment);
+	}
+	
+	// Check if transaction has a fee
+	secp256k1_pedersen_commitment feeCommitment;
+	if(task.fee) {
+	
+		// Check if committing to the fee with a zero blind failed
+		if(!secp256k1_pedersen_commit(context, &feeCommitment, zeroBlind, task.fee, &secp256k1_generator_const_h, &secp256k1_generator_const_g)) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Add fee commitment to the positive commitments since it's a positive overage that's created like an output
+		positiveCommitments.push_back(&feeCommitment);
+	}
+	
+	// Check if kernel offset isn't zero
+	secp256k1_pedersen_commitment kernelOffsetCommitment;
+	if(memcmp(task.kernelOffset.data(), zeroBlind, sizeof(zeroBlind))) {
+	
+		// Check if committing to zero with the kernel offset as the blind failed
+		if(!secp256k1_pedersen_commit(context, &kernelOffsetCommitment, task.kernelOffset.data(), 0, &secp256k1_generator_const_h, &secp256k1_generator_const_g)) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Add kernel offset commitment to the negative commitments since it's the part of the excess that isn't in the kernels
+		negativeCommitments.push_back(&kernelOffsetCommitment);
+	}
+	
+	// Check if aborted or the outputs plus the fee minus the inputs and the reward don't equal the kernel excesses plus the kernel offset like the chain's kernel sums require
+	if(*task.abortSignal.aborted || !secp256k1_pedersen_verify_tally(context, positiveCommitments.data(), positiveCommitments.size(), negativeCommitments.data(), negativeCommitments.size())) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if verifying the outputs' proofs failed
+	if(!runInParallel(instanceData, BULK_PRIORITY, context, numberOfOutputs, BULLETPROOFS_PER_BATCH, [instanceData, context, &task, &commitments, numberOfInputs, &reportProgress](size_t start, size_t end, secp256k1_scratch_space *scratchSpace) -> bool {
+	
+		// Go through all proofs in the batch
+		bool sameSize = true;
+		vector<size_t> uncachedProofs;
+		vector<string> proofCacheKeys(end - start);
+		vector<const uint8_t *> proofs;
+		vector<const secp256k1_pedersen_commitment *> proofCommitments;
+		for(size_t i = start; i < end; ++i) {
+		
+			// Check if proof was already verified
+			if(verificationCacheContains(&instanceData->proofCache, proofCacheKeys[i - start], {{task.proofs[i].data(), task.proofs[i].size()}, {&task.outputs[i * COMMIT_SIZE], COMMIT_SIZE}, {nullptr, 0}})) {
+			
+				// Skip proof
+				continue;
+			}
+			
+			// Check if proof's size is different than the first uncached proof's size
+			if(!uncachedProofs.empty() && task.proofs[i].size() != task.proofs[uncachedProofs.front()].size()) {
+			
+				// Clear same size
+				sameSize = false;
+			}
+			
+			// Add proof and its output to the batch's uncached proofs and commitments
+			uncachedProofs.push_back(i);
+			proofs.push_back(task.proofs[i].data());
+			proofCommitments.push_back(&commitments[numberOfInputs + i]);
+		}
+		
+		// Check if all the proofs in the batch were already verified
+		if(uncachedProofs.empty()) {
+		
+			// Report progress
+			reportProgress(end - start);
+			
+			// Return true
+			return true;
+		}
+		
+		// Check if all the uncached proofs in the batch have the same size
+		if(sameSize) {
+		
+			// Check if the batch's uncached proofs are verified together
+			vector<secp256k1_generator> valueGenerators(uncachedProofs.size(), secp256k1_generator_const_h);
+			if(secp256k1_bulletproof_rangeproof_verify_multi(context, scratchSpace, instanceData->generators, proofs.data(), proofs.size(), task.proofs[uncachedProofs.front()].size(), nullptr, proofCommitments.data(), 1, BULLETPROOF_NUMBER_OF_BITS, valueGenerators.data(), nullptr, nullptr)) {
+			
+				// Go through all uncached proofs in the batch
+				for(const size_t i : uncachedProofs) {
+				
+					// Add proof to the proof cache
+					verificationCacheAdd(&instanceData->proofCache, proofCacheKeys[i - start]);
+				}
+				
+				// Report progress
+				reportProgress(end - start);
+				
+				// Return true
+				return true;
+			}
+		}
+		
+		// Go through all uncached proofs in the batch since they couldn't be verified together
+		for(const size_t i : uncachedProofs) {
+		
+			// Check if proof isn't verified
+			if(!secp256k1_bulletproof_rangeproof_verify(context, scratchSpace, instanceData->generators, task.proofs[i].data(), task.proofs[i].size(), nullptr, &commitments[numberOfInputs + i], 1, BULLETPROOF_NUMBER_OF_BITS, &secp256k1_generator_const_h, nullptr, 0)) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Add proof to the proof cache
+			verificationCacheAdd(&instanceData->proofCache, proofCacheKeys[i - start]);
+		}
+		
+		// Report progress
+		reportProgress(end - start);
+		
+		// Return true
+		return true;
+	}, task.abortSignal.aborted.get())) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Return if verifying the kernels' signatures was successful
+	return runInParallel(instanceData, BULK_PRIORITY, context, numberOfKernels, KERNELS_PER_BATCH, [instanceData, context, &task, &commitments, numberOfInputs, numberOfOutputs, &reportProgress](size_t start, size_t end, secp256k1_scratch_space *scratchSpace) -> bool {
+	
+		// Go through all kernels in the batch
+		vector<size_t> uncachedKernels;
+		vector<string> signatureCacheKeys(end - start);
+		vector<secp256k1_pubkey> publicKeys;
+		vector<uint8_t> signatures;
+		vector<uint8_t> messages;
+		for(size_t i = start; i < end; ++i) {
+		
+			// Check if getting kernel excess's public key failed
+			secp256k1_pubkey publicKey;
+			if(!secp256k1_pedersen_commitment_to_pubkey(context, &publicKey, &commitments[numberOfInputs + numberOfOutputs + i])) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Check if serializing kernel excess's public key failed
+			uint8_t serializedPublicKey[PUBLIC_KEY_SIZE];
+			size_t serializedPublicKeySize = sizeof(serializedPublicKey);
+			if(!secp256k1_ec_pubkey_serialize(context, serializedPublicKey, &serializedPublicKeySize, &publicKey, SECP256K1_EC_COMPRESSED)) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Check if kernel's signature was already verified using the same key as verifying it as a single-signer signature
+			const uint8_t partial = false;
+			if(verificationCacheContains(&instanceData->signatureCache, signatureCacheKeys[i - start], {{&SINGLE_SIGNER_SIGNATURE_CACHE_TAG, sizeof(SINGLE_SIGNER_SIGNATURE_CACHE_TAG)}, {&task.kernelSignatures[i * SINGLE_SIGNER_SIGNATURE_SIZE], SINGLE_SIGNER_SIGNATURE_SIZE}, {&task.kernelMessages[i * SINGLE_SIGNER_MESSAGE_SIZE], SINGLE_SIGNER_MESSAGE_SIZE}, {nullptr, 0}, {serializedPublicKey, serializedPublicKeySize}, {serializedPublicKey, serializedPublicKeySize}, {&partial, sizeof(partial)}})) {
+			
+				// Continue
+				continue;
+			}
+			
+			// Add kernel's public key, signature, and message to the batch's uncached kernels
+			uncachedKernels.push_back(i);
+			publicKeys.push_back(publicKey);
+			signatures.insert(signatures.end(), &task.kernelSignatures[i * SINGLE_SIGNER_SIGNATURE_SIZE], &task.kernelSignatures[(i + 1) * SINGLE_SIGNER_SIGNATURE_SIZE]);
+			messages.insert(messages.end(), &task.kernelMessages[i * SINGLE_SIGNER_MESSAGE_SIZE], &task.kernelMessages[(i + 1) * SINGLE_SIGNER_MESSAGE_SIZE]);
+		}
+		
+		// Check if the batch's uncached kernels' signatures aren't all valid when verified together in one randomly weighted multi-scalar multiplication
+		if(!verifySingleSignerSignatures(context, scratchSpace, signatures.data(), messages.data(), publicKeys.data(), uncachedKernels.size(), task.kernelWeightsSeed.data())) {
+		
+			// Go through all uncached kernels in the batch to find the one that failed since they couldn't be verified together
+			for(size_t i = 0; i < uncachedKernels.size(); ++i) {
+			
+				// Check if kernel's signature isn't verified
+				if(!secp256k1_aggsig_verify_single(context, &signatures[i * SINGLE_SIGNER_SIGNATURE_SIZE], &messages[i * SINGLE_SIGNER_MESSAGE_SIZE], nullptr, &publicKeys[i], &publicKeys[i], nullptr, false)) {
+				
+					// Return false
+					return false;
+				}
+			}
+		}
+		
+		// Go through all uncached kernels in the batch
+		for(const size_t i : uncachedKernels) {
+		
+			// Add kernel's signature to the signature cache
+			verificationCacheAdd(&instanceData->signatureCache, signatureCacheKeys[i - start]);
+		}
+		
+		// Report progress
+		reportProgress(end - start);
+		
+		// Return true
+		return true;
+	}, task.abortSignal.aborted.get());
+}
+
+// Queue async task
+napi_value queueAsyncTask(napi_env environment, const char *name, size_t priority, const shared_ptr<atomic<bool>> &aborted, const function<void()> &execute, const function<napi_value(napi_env environment)> &complete) {
+
+	// Return queueing streaming async task without a callback
+	return queueStreamingAsyncTask(environment, name, nullptr, priority, aborted, [execute](napi_threadsafe_function callback) {
+	
+		// Run execute
+		execute();
+		
+	}, complete);
+}
+
+// Clear rewind scan result
+void clearRewindScanResult(RewindScanResult &result) {
+
+	// Clear result's value, blind, and message
+	secureClear(result.value.data(), result.value.size());
+	secureClear(result.blind.data(), result.blind.size());
+	secureClear(result.message.data(), result.message.size());
+}
+
+// Queue streaming async task
+napi_value queueStreamingAsyncTask(napi_env environment, const char *name, napi_value callback, size_t priority, const shared_ptr<atomic<bool>> &aborted, const function<void(napi_threadsafe_function callback)> &execute, const function<napi_value(napi_env environment)> &complete) {
+
+	// Check if getting instance data failed
+	InstanceData *instanceData;
+	if(napi_get_instance_data(environment, reinterpret_cast<void **>(&instanceData)) != napi_ok) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if creating async task failed
+	AsyncTask *asyncTask = new(nothrow) AsyncTask;
+	if(!asyncTask) {
+	
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Set async task's execute, complete, and executed
+	asyncTask->execute = execute;
+	asyncTask->complete = complete;
+	asyncTask->executed = false;
+	
+	// Check if creating promise failed
+	napi_value promise;
+	if(napi_create_promise(environment, &asyncTask->deferred, &promise) != napi_ok) {
+	
+		// Free memory
+		delete asyncTask;
+		
+		// Return operation failed
+		return operationFailed(environment);
+	}
+	
+	// Check if creating async task's callback failed
+	// The promise is resolved when the callback is finalized so that it happens after all streamed events were delivered
+	napi_value resourceName;
+	if(napi_create_string_utf8(environment, name, NAPI_AUTO_LENGTH, &resourceName) != napi_ok || napi_create_threadsafe_function(environment, callback, nullptr, resourceName, STREAMED_EVENTS_QUEUE_SIZE, 1, asyncTask, [](napi_env environment, void *finalizeData, void *finalizeHint) {
+	
+		// Get async task
+		AsyncTask *asyncTask = reinterpret_cast<AsyncTask *>(finalizeData);
+		
+		// Resolve async task's promise with its result or operation failed if it didn't run
+		napi_resolve_deferred(environment, asyncTask->deferred, asyncTask->executed ? asyncTask->complete(environment) : operationFailed(environment));
+		
+		// Check if getting instance data was successful
+		InstanceData *instanceData;
+		if(napi_get_instance_data(environment, reinterpret_cast<void **>(&instanceData)) == napi_ok && instanceData) {
+		
+			// Update external memory since the task could have grown the caches or helper scratch spaces
+			updateExternalMemory(environment, instanceData);
+		}
+		
+		// Free memory
+		delete asyncTask;
+		
+	}, nullptr, [](napi_env environment, napi_value callback, void *context, void *data) {
+	
+		// Get event
+		function<void(napi_env environment, napi_value callback)> *event = reinterpret_cast<function<void(napi_env environment, napi_value callback)> *>(data);
+		
+		// Run event which clears any secrets it has even if the environment is being torn down
+		(*event)(environment, callback);
+		
+		// Free memory
+		delete event;
+		
+	}, &asyncTask->callback) != napi_ok) {
+	
+		// Resolve async task's promise with operation failed
+		napi_resolve_deferred(environment, asyncTask->deferred, operationFailed(environment));
+		
+		// Free memory
+		delete asyncTask;
+		
+		// Return promise
+		return promise;
+	}
+	
+	// Check if scheduling async task on the scheduler instead of the shared libuv thread pool failed
+	// Only interactive tasks can be stolen by idle threads since bulk tasks could occupy an interactive thread for a long time
+	// The task's abort flag is registered with the job so that the task can be aborted if the instance is torn down while it's running
+	if(!scheduleJob(instanceData, priority, priority == INTERACTIVE_PRIORITY, aborted, [asyncTask](size_t threadPriority) {
+	
+		// Run async task's execute
+		asyncTask->execute(asyncTask->callback);
+		
+		// Set async task's executed
+		asyncTask->executed = true;
+		
+		// Release async task's callback which will resolve its promise once all streamed events were delivered
+		napi_release_threadsafe_function(asyncTask->callback, napi_tsfn_release);
+		
+	})) {
+	
+		// Release async task's callback which will resolve its promise with operation failed
+		napi_release_threadsafe_function(asyncTask->callback, napi_tsfn_release);
+	}
+	
+	// Return promise
+	return promise;
+}
+
+// Stream event
+bool streamEvent(napi_threadsafe_function callback, const atomic<bool> *aborted, const function<void(napi_env environment, napi_value callback)> &event) {
+
+	// Check if creating a copy of the event failed
+	function<void(napi_env environment, napi_value callback)> *eventCopy = new(nothrow) function<void(napi_env environment, napi_value callback)>(event);
+	if(!eventCopy) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Loop until the event is queued
+	// The queue is retried instead of blocking on it since the JS thread can't empty it while it's tearing down the instance and waiting for this job to be aborted
+	while(true) {
+	
+		// Check if queueing the event was successful
+		const napi_status status = napi_call_threadsafe_function(callback, eventCopy, napi_tsfn_nonblocking);
+		if(status == napi_ok) {
+		
+			// Return true
+			return true;
+		}
+		
+		// Check if queueing the event failed for a reason other than the queue being full or the task was aborted
+		if(status != napi_queue_full || *aborted) {
+		
+			// Free memory
+			delete eventCopy;
+			
+			// Return false
+			return false;
+		}
+		
+		// Wait for the JS thread to deliver some of the queued events
+		this_thread::sleep_for(STREAM_EVENT_RETRY_DELAY);
+	}
+}
+
+// Get abort signal
+bool getAbortSignal(napi_env environment, napi_value value, AbortSignal &abortSignal) {
+
+	// Initialize abort signal's signal and listener
+	abortSignal.signal = nullptr;
+	abortSignal.listener = nullptr;
+	
+	// Check if getting value's type failed
+	napi_valuetype type;
+	if(napi_typeof(environment, value, &type) != napi_ok) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if value isn't provided
+	if(type == napi_undefined) {
+	
+		// Set abort signal's aborted to a flag that's never set
+		abortSignal.aborted.reset(new(nothrow) atomic<bool>(false));
+		
+		// Return if setting abort signal's aborted was successful
+		return static_cast<bool>(abortSignal.aborted);
+	}
+	
+	// Check if getting if the signal is already aborted failed
+	napi_value temp;
+	bool alreadyAborted;
+	if(napi_get_named_property(environment, value, "aborted", &temp) != napi_ok || napi_get_value_bool(environment, temp, &alreadyAborted) != napi_ok) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if setting abort signal's aborted failed
+	abortSignal.aborted.reset(new(nothrow) atomic<bool>(alreadyAborted));
+	if(!abortSignal.aborted) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if signal is already aborted
+	if(alreadyAborted) {
+	
+		// Return true
+		return true;
+	}
+	
+	// Check if creating listener's data failed
+	shared_ptr<atomic<bool>> *listenerData = new(nothrow) shared_ptr<atomic<bool>>(abortSignal.aborted);
+	if(!listenerData) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if creating listener failed
+	napi_value listener;
+	if(napi_create_function(environment, nullptr, 0, [](napi_env environment, napi_callback_info arguments) -> napi_value {
+	
+		// Check if getting listener's data was successful
+		shared_ptr<atomic<bool>> *listenerData;
+		if(napi_get_cb_info(environment, arguments, nullptr, nullptr, nullptr, reinterpret_cast<void **>(&listenerData)) == napi_ok) {
+		
+			// Set aborted
+			**listenerData = true;
+		}
+		
+		// Return nothing
+		return nullptr;
+		
+	}, listenerData, &listener) != napi_ok) {
+	
+		// Free memory
+		delete listenerData;
+		
+		// Return false
+		return false;
+	}
+	
+	// Check if freeing listener's data when the listener is garbage collected failed
+	if(napi_add_finalizer(environment, listener, listenerData, [](napi_env environment, void *finalizeData, void *finalizeHint) {
+	
+		// Free memory
+		delete reinterpret_cast<shared_ptr<atomic<bool>> *>(finalizeData);
+		
+	}, nullptr, nullptr) != napi_ok) {
+	
+		// Free memory
+		delete listenerData;
+		
+		// Return false
+		return false;
+	}
+	
+	// Check if adding listener to the signal failed
+	napi_value addEventListener;
+	array<napi_value, 3> addEventListenerArguments = {nullptr, listener, nullptr};
+	napi_value once;
+	if(napi_get_named_property(environment, value, "addEventListener", &addEventListener) != napi_ok || napi_create_string_utf8(environment, "abort", NAPI_AUTO_LENGTH, &addEventListenerArguments[0]) != napi_ok || napi_create_object(environment, &addEventListenerArguments[2]) != napi_ok || napi_get_boolean(environment, true, &once) != napi_ok || napi_set_named_property(environment, addEventListenerArguments[2], "once", once) != napi_ok || napi_call_function(environment, value, addEventListener, addEventListenerArguments.size(), addEventListenerArguments.data(), nullptr) != napi_ok) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if creating weak references to the signal and listener failed
+	if(napi_create_reference(environment, value, 0, &abortSignal.signal) != napi_ok || napi_create_reference(environment, listener, 0, &abortSignal.listener) != napi_ok) {
+	
+		// Release abort signal
+		releaseAbortSignal(environment, abortSignal);
+		
+		// Return false
+		return false;
+	}
+	
+	// Return true
+	return true;
+}
+
+// Release abort signal
+void releaseAbortSignal(napi_env environment, AbortSignal &abortSignal) {
+
+	// Check if abort signal's signal and listener exist
+	if(abortSignal.signal && abortSignal.listener) {
+	
+		// Check if getting the signal and listener was successful and they haven't been garbage collected
+		napi_value signal;
+		array<napi_value, 2> removeEventListenerArguments = {nullptr, nullptr};
+		if(napi_get_reference_value(environment, abortSignal.signal, &signal) == napi_ok && signal && napi_get_reference_value(environment, abortSignal.listener, &removeEventListenerArguments[1]) == napi_ok && removeEventListenerArguments[1]) {
+		
+			// Check if getting the signal's remove event listener function was successful
+			napi_value removeEventListener;
+			if(napi_get_named_property(environment, signal, "removeEventListener", &removeEventListener) == napi_ok && napi_create_string_utf8(environment, "abort", NAPI_AUTO_LENGTH, &removeEventListenerArguments[0]) == napi_ok) {
+			
+				// Remove listener from the signal so that it doesn't accumulate listeners
+				napi_call_function(environment, signal, removeEventListener, removeEventListenerArguments.size(), removeEventListenerArguments.data(), nullptr);
+			}
+		}
+	}
+	
+	// Check if abort signal's signal exists
+	if(abortSignal.signal) {
+	
+		// Delete abort signal's signal
+		napi_delete_reference(environment, abortSignal.signal);
+		abortSignal.signal = nullptr;
+	}
+	
+	// Check if abort signal's listener exists
+	if(abortSignal.listener) {
+	
+		// Delete abort signal's listener
+		napi_delete_reference(environment, abortSignal.listener);
+		abortSignal.listener = nullptr;
+	}
+}
+
+// Run in parallel
+bool runInParallel(InstanceData *instanceData, size_t priority, const secp256k1_context *context, size_t numberOfItems, size_t itemsPerBatch, const function<bool(size_t start, size_t end, secp256k1_scratch_space *scratchSpace)> &batchFunction, const atomic<bool> *aborted) {
+
+	// Check if getting the scheduler was successful
+	Scheduler *scheduler = getScheduler();
+	size_t numberOfThreads = 0;
+	if(scheduler) {
+	
+		// Get the scheduler's total number of threads while it's locked since they can be changed until its threads are started
+		lock_guard<mutex> lock(scheduler->lock);
+		numberOfThreads = scheduler->numberOfThreads[INTERACTIVE_PRIORITY] + scheduler->numberOfThreads[BULK_PRIORITY];
+	}
+	
+	// Get number of batches and helpers
+	const size_t numberOfBatches = (numberOfItems + itemsPerBatch - 1) / itemsPerBatch;
+	const size_t numberOfHelpers = (scheduler) ? min(numberOfBatches, numberOfThreads) - ((numberOfBatches) ? 1 : 0) : 0;
+	
+	// Initialize next batch and failed
+	atomic<size_t> nextBatch(0);
+	atomic<bool> failed(false);
+	
+	// Create worker
+	const auto worker = [instanceData, scheduler, priority, context, numberOfItems, itemsPerBatch, numberOfBatches, &batchFunction, aborted, &nextBatch, &failed](bool yieldToInteractive) {
+	
+		// Check if context exists
+		secp256k1_scratch_space *scratchSpace = nullptr;
+		if(context) {
+		
+			// Check if acquiring a helper scratch space failed
+			scratchSpace = acquireHelperScratchSpace(instanceData, context);
+			if(!scratchSpace) {
+			
+				// Set failed
+				failed = true;
+				
+				// Return
+				return;
+			}
+		}
+		
+		// Loop through remaining batches while nothing has failed
+		for(size_t batch = nextBatch++; batch < numberOfBatches && !failed; batch = nextBatch++) {
+		
+			// Check if aborted
+			if(aborted && *aborted) {
+			
+				// Set failed
+				failed = true;
+				
+				// Break
+				break;
+			}
+			
+			// Check if running batch function on the batch failed
+			if(!batchFunction(batch * itemsPerBatch, min((batch + 1) * itemsPerBatch, numberOfItems), scratchSpace)) {
+			
+				// Set failed
+				failed = true;
+			}
+			
+			// Check if yielding to interactive jobs and one is waiting
+			if(yieldToInteractive && hasScheduledJobs(scheduler, INTERACTIVE_PRIORITY)) {
+			
+				// Break
+				break;
+			}
+		}
+		
+		// Check if scratch space exists
+		if(scratchSpace) {
+		
+			// Release helper scratch space so that later runs can reuse it
+			releaseHelperScratchSpace(instanceData, scratchSpace);
+		}
+	};
+	
+	// Check if creating parallel run failed
+	shared_ptr<ParallelRun> parallelRun(new(nothrow) ParallelRun);
+	if(!parallelRun) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Initialize parallel run's running helpers and closed
+	parallelRun->runningHelpers = 0;
+	parallelRun->closed = false;
+	
+	// Go through all helpers
+	const auto *workerPointer = &worker;
+	for(size_t i = 0; i < numberOfHelpers; ++i) {
+	
+		// Schedule helper as a job that idle threads of either priority can steal and stop scheduling helpers if it fails
+		// Helpers don't need their own abort flag since the worker checks the run's abort flag between batches
+		if(!scheduleJob(instanceData, priority, true, nullptr, [parallelRun, workerPointer, priority](size_t threadPriority) {
+		
+			// Lock parallel run
+			{
+				unique_lock<mutex> lock(parallelRun->lock);
+				
+				// Check if parallel run is closed
+				if(parallelRun->closed) {
+				
+					// Return
+					return;
+				}
+				
+				// Increment parallel run's running helpers
+				++parallelRun->runningHelpers;
+			}
+			
+			// Run worker and yield to interactive jobs between batches if running bulk work on an interactive thread
+			(*workerPointer)(threadPriority == INTERACTIVE_PRIORITY && priority == BULK_PRIORITY);
+			
+			// Lock parallel run
+			unique_lock<mutex> lock(parallelRun->lock);
+			
+			// Check if no helpers are running
+			if(!--parallelRun->runningHelpers) {
+			
+				// Notify that the helpers finished
+				parallelRun->helpersFinished.notify_all();
+			}
+			
+		})) {
+		
+			// Break
+			break;
+		}
+	}
+	
+	// Run worker on the current thread
+	worker(false);
+	
+	// Close parallel run so that helpers that haven't started won't run and wait for running helpers to finish
+	unique_lock<mutex> lock(parallelRun->lock);
+	parallelRun->closed = true;
+	parallelRun->helpersFinished.wait(lock, [&parallelRun]() -> bool {
+	
+		// Return if no helpers are running
+		return !parallelRun->runningHelpers;
+	});
+	
+	// Return if nothing failed
+	return !failed;
+}
+
+// Acquire helper scratch space
+secp256k1_scratch_space *acquireHelperScratchSpace(InstanceData *instanceData, const secp256k1_context *context) {
+
+	// Lock helper scratch spaces
+	HelperScratchSpaces *helperScratchSpaces = &instanceData->helperScratchSpaces;
+	{
+		lock_guard<mutex> lock(helperScratchSpaces->lock);
+		
+		// Check if an idle helper scratch space exists
+		if(!helperScratchSpaces->idle.empty()) {
+		
+			// Return idle helper scratch space
+			secp256k1_scratch_space *scratchSpace = helperScratchSpaces->idle.back();
+			helperScratchSpaces->idle.pop_back();
+			return scratchSpace;
+		}
+	}
+	
+	// Check if creating scratch space failed
+	secp256k1_scratch_space *scratchSpace = secp256k1_scratch_space_create(context, Secp256k1Zkp::SCRATCH_SPACE_SIZE);
+	if(!scratchSpace) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Add scratch space's memory to the helper scratch spaces' memory usage
+	lock_guard<mutex> lock(helperScratchSpaces->lock);
+	helperScratchSpaces->memoryUsage += scratchSpaceMemoryUsage(scratchSpace);
+	
+	// Return scratch space
+	return scratchSpace;
+}
+
+// Release helper scratch space
+void releaseHelperScratchSpace(InstanceData *instanceData, secp256k1_scratch_space *scratchSpace) {
+
+	// Lock helper scratch spaces
+	HelperScratchSpaces *helperScratchSpaces = &instanceData->helperScratchSpaces;
+	lock_guard<mutex> lock(helperScratchSpaces->lock);
+	
+	// Add scratch space to the idle helper scratch spaces
+	helperScratchSpaces->idle.push_back(scratchSpace);
+}
+
+// Get scheduler
+Scheduler *getScheduler() {
+
+	// Create the scheduler the first time it's used and never destroy it since its threads are shared by all instances in the process and can outlive any of them
+	static Scheduler *const scheduler = []() -> Scheduler * {
+	
+		// Check if creating scheduler failed
+		Scheduler *scheduler = new(nothrow) Scheduler;
+		if(!scheduler) {
+		
+			// Return nothing
+			return nullptr;
+		}
+		
+		// Set scheduler's number of threads so that all instances together use at most one thread per core
+		scheduler->numberOfThreads[INTERACTIVE_PRIORITY] = 1;
+		scheduler->numberOfThreads[BULK_PRIORITY] = max(static_cast<size_t>(thread::hardware_concurrency()), static_cast<size_t>(2)) - 1;
+		
+		// Return scheduler
+		return scheduler;
+	}();
+	
+	// Return scheduler
+	return scheduler;
+}
+
+// Schedule job
+bool scheduleJob(InstanceData *instanceData, size_t priority, bool stealable, const shared_ptr<atomic<bool>> &aborted, const function<void(size_t threadPriority)> &run) {
+
+	// Check if getting the scheduler failed
+	Scheduler *scheduler = getScheduler();
+	if(!scheduler) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Lock scheduler
+	unique_lock<mutex> lock(scheduler->lock);
+	
+	// Check if instance data's scheduler jobs are stopping
+	if(instanceData->schedulerStopping) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if scheduler's threads haven't been started
+	if(scheduler->threads.empty()) {
+	
+		// Go through all priorities
+		for(size_t threadPriority = INTERACTIVE_PRIORITY; threadPriority <= BULK_PRIORITY; ++threadPriority) {
+		
+			// Go through all of the priority's threads
+			for(size_t i = 0; i < scheduler->numberOfThreads[threadPriority]; ++i) {
+			
+				// Start running scheduler thread for the priority
+				scheduler->threads.emplace_back(runSchedulerThread, scheduler, threadPriority);
+			}
+		}
+	}
+	
+	// Add job to the scheduler's jobs for the priority
+	scheduler->jobs[priority].push_back({run, stealable, instanceData, aborted});
+	
+	// Notify all threads since not every thread can run the job
+	scheduler->jobAvailable.notify_all();
+	
+	// Return true
+	return true;
+}
+
+// Run scheduler thread
+void runSchedulerThread(Scheduler *scheduler, size_t priority) {
+
+	// Lock scheduler
+	unique_lock<mutex> lock(scheduler->lock);
+	
+	// Loop forever since the scheduler is shared by the whole process
+	while(true) {
+	
+		// Check if a job for the priority exists
+		deque<SchedulerJob> &jobs = scheduler->jobs[priority];
+		deque<SchedulerJob> &otherJobs = scheduler->jobs[(priority == INTERACTIVE_PRIORITY) ? BULK_PRIORITY : INTERACTIVE_PRIORITY];
+		if(!jobs.empty()) {
+		
+			// Move job to the running jobs
+			scheduler->runningJobs.push_front(move(jobs.front()));
+			jobs.pop_front();
+		}
+		
+		// Otherwise
+		else {
+		
+			// Check if a job that can be stolen exists for the other priority
+			const deque<SchedulerJob>::iterator stealableJob = find_if(otherJobs.begin(), otherJobs.end(), [](const SchedulerJob &otherJob) -> bool {
+			
+				// Return if other job is stealable
+				return otherJob.stealable;
+			});
+			if(stealableJob == otherJobs.end()) {
+			
+				// Wait for a job to be available
+				scheduler->jobAvailable.wait(lock);
+				
+				// Continue
+				continue;
+			}
+			
+			// Steal job and move it to the running jobs
+			scheduler->runningJobs.push_front(move(*stealableJob));
+			otherJobs.erase(stealableJob);
+		}
+		
+		// Unlock scheduler while running job
+		const list<SchedulerJob>::iterator job = scheduler->runningJobs.begin();
+		lock.unlock();
+		job->run(priority);
+		lock.lock();
+		
+		// Remove job from the running jobs
+		scheduler->runningJobs.erase(job);
+		
+		// Notify that a job finished
+		scheduler->jobFinished.notify_all();
+	}
+}
+
+// Has scheduled jobs
+bool hasScheduledJobs(Scheduler *scheduler, size_t priority) {
+
+	// Return if scheduler has jobs for the priority
+	lock_guard<mutex> lock(scheduler->lock);
+	return !scheduler->jobs[priority].empty();
+}
+
+// Stop scheduler
+void stopScheduler(InstanceData *instanceData) {
+
+	// Check if getting the scheduler failed
+	Scheduler *scheduler = getScheduler();
+	if(!scheduler) {
+	
+		// Return
+		return;
+	}
+	
+	// Lock scheduler
+	unique_lock<mutex> lock(scheduler->lock);
+	
+	// Set instance data's scheduler stopping so that its running jobs can't schedule more jobs
+	instanceData->schedulerStopping = true;
+	
+	// Go through all priorities
+	for(deque<SchedulerJob> &jobs : scheduler->jobs) {
+	
+		// Discard instance data's jobs that haven't started
+		jobs.erase(remove_if(jobs.begin(), jobs.end(), [instanceData](const SchedulerJob &job) -> bool {
+		
+			// Return if job belongs to the instance data
+			return job.instanceData == instanceData;
+			
+		}), jobs.end());
+	}
+	
+	// Go through all running jobs
+	for(const SchedulerJob &job : scheduler->runningJobs) {
 	
-		// Check if getting public key failed
-		napi_value publicKey;
-		if(napi_get_element(environment, argv[0], i, &publicKey) != napi_ok) {
+		// Check if job belongs to the instance data and it can be aborted
+		if(job.instanceData == instanceData && job.aborted) {
 		
-			// Return operation failed
-			return OPERATION_FAILED;
+			// Abort job so that it stops between batches and doesn't wait for the JS thread to deliver its events
+			*job.aborted = true;
 		}
+	}
+	
+	// Wait for the instance data's running jobs to finish
+	scheduler->jobFinished.wait(lock, [scheduler, instanceData]() -> bool {
+	
+		// Return if no running jobs belong to the instance data
+		return none_of(scheduler->runningJobs.begin(), scheduler->runningJobs.end(), [instanceData](const SchedulerJob &job) -> bool {
 		
-		// Check if getting public key as a buffer failed
-		const tuple<uint8_t *, size_t, bool> publicKeyBuffer = uint8ArrayToBuffer(environment, publicKey);
-		if(!get<2>(publicKeyBuffer)) {
+			// Return if job belongs to the instance data
+			return job.instanceData == instanceData;
+		});
+	});
+}
+
+// Configure verification cache
+bool configureVerificationCache(napi_env environment, VerificationCache *cache, bool enabled, size_t capacity) {
+
+	// Lock cache
+	lock_guard<mutex> lock(cache->lock);
+	
+	// Check if cache is being enabled and its salt doesn't exist
+	if(enabled && capacity && cache->salt.empty()) {
+	
+		// Check if creating random salt failed
+		// The salt is never changed once the cache is enabled so that it can be read without the lock
+		vector<uint8_t> salt(VERIFICATION_CACHE_SALT_SIZE);
+		if(!randomFill(environment, salt.data(), salt.size())) {
 		
-			// Return operation failed
-			return OPERATION_FAILED;
+			// Return false
+			return false;
 		}
 		
-		// Append public key buffer to public keys
-		publicKeys.insert(publicKeys.cend(), get<0>(publicKeyBuffer), get<0>(publicKeyBuffer) + get<1>(publicKeyBuffer));
-		
-		// Append public key's size to public keys sizes
-		publicKeysSizes[i] = get<1>(publicKeyBuffer);
+		// Set cache's salt
+		cache->salt = move(salt);
 	}
 	
-	// Check if combining public keys failed
-	vector<uint8_t> result(Secp256k1Zkp::publicKeySize(instanceData));
-	if(!Secp256k1Zkp::combinePublicKeys(instanceData, result.data(), publicKeys.data(), publicKeysSizes.data(), numberOfPublicKeys)) {
+	// Check if cache has more entries than it can hold
+	if(cache->keys.size() > (enabled ? capacity : 0)) {
 	
-		// Return operation failed
-		return OPERATION_FAILED;
+		// Loop while cache has more entries than it can hold
+		while(cache->keys.size() > (enabled ? capacity : 0)) {
+		
+			// Remove least recently used entry from the cache
+			cache->entries.erase(cache->keys.back());
+			cache->keys.pop_back();
+		}
+		
+		// Shrink the cache's hash table so that the removed entries' buckets are released and no longer reported as external memory
+		cache->entries.rehash(0);
 	}
 	
-	// Return result as a uint8 array
-	return bufferToUint8Array(environment, result.data(), result.size());
+	// Set cache's enabled and capacity
+	cache->enabled = enabled;
+	cache->capacity = capacity;
+	
+	// Return true
+	return true;
 }
 
-// Create secret nonce
-napi_value createSecretNonce(napi_env environment, napi_callback_info arguments) {
+// Verification cache contains
+bool verificationCacheContains(VerificationCache *cache, string &key, const vector<tuple<const uint8_t *, size_t>> &items) {
 
-	// Check if getting instance data failed
-	InstanceData *instanceData = getInstanceData(environment);
-	if(!instanceData) {
+	// Lock cache
+	unique_lock<mutex> lock(cache->lock);
 	
-		// Return operation failed
-		return OPERATION_FAILED;
-	}
-
-	// Check if arguments were provided
-	size_t argc = 0;
-	if(napi_get_cb_info(environment, arguments, &argc, nullptr, nullptr, nullptr) != napi_ok || argc) {
+	// Check if cache is disabled
+	if(!cache->enabled || !cache->capacity) {
 	
-		// Return operation failed
-		return OPERATION_FAILED;
+		// Clear key
+		key.clear();
+		
+		// Return false
+		return false;
 	}
 	
-	// Check if creating random seed failed
-	vector<uint8_t> seed(Secp256k1Zkp::seedSize(instanceData));
-	if(!randomFill(environment, seed.data(), seed.size())) {
+	// Unlock cache while getting the key from the salted hash of the items
+	lock.unlock();
+	vector<const uint8_t *> itemData(items.size());
+	vector<size_t> itemSizes(items.size());
+	for(size_t i = 0; i < items.size(); ++i) {
 	
-		// Return operation failed
-		return OPERATION_FAILED;
+		// Get item's data and size
+		itemData[i] = get<0>(items[i]);
+		itemSizes[i] = get<1>(items[i]);
 	}
+	key.resize(VERIFICATION_CACHE_KEY_SIZE);
+	verificationCacheKey(reinterpret_cast<uint8_t *>(&key[0]), cache->salt.data(), itemData.data(), itemSizes.data(), items.size());
+	lock.lock();
 	
-	// Check if creating secure nonce failed
-	vector<uint8_t> nonce(Secp256k1Zkp::nonceSize(instanceData));
-	if(!Secp256k1Zkp::createSecretNonce(instanceData, nonce.data(), seed.data(), seed.size())) {
-	
-		// Clear seed
-		memset(seed.data(), 0, seed.size());
+	// Check if cache doesn't contain the key
+	const unordered_map<string, list<string>::iterator>::iterator entry = cache->entries.find(key);
+	if(entry == cache->entries.end()) {
 	
-		// Return operation failed
-		return OPERATION_FAILED;
+		// Increment cache's misses
+		++cache->misses;
+		
+		// Return false
+		return false;
 	}
 	
-	// Clear seed
-	memset(seed.data(), 0, seed.size());
+	// Increment cache's hits
+	++cache->hits;
 	
-	// Return nonce as a uint8 array
-	return bufferToUint8Array(environment, nonce.data(), nonce.size());
+	// Make entry the most recently used
+	cache->keys.splice(cache->keys.begin(), cache->keys, entry->second);
+	
+	// Return true
+	return true;
 }
 
-// Create message hash signature
-napi_value createMessageHashSignature(napi_env environment, napi_callback_info arguments) {
+// Verification cache add
+bool verificationCacheAdd(VerificationCache *cache, const string &key) {
 
-	// Check if getting instance data failed
-	InstanceData *instanceData = getInstanceData(environment);
-	if(!instanceData) {
+	// Lock cache
+	lock_guard<mutex> lock(cache->lock);
 	
-		// Return operation failed
-		return OPERATION_FAILED;
+	// Check if key wasn't created or cache is disabled
+	if(key.empty() || !cache->enabled || !cache->capacity) {
+	
+		// Return false
+		return false;
 	}
-
-	// Check if not enough arguments were provided
-	size_t argc = 2;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
 	
-		// Return operation failed
-		return OPERATION_FAILED;
+	// Check if cache already contains the key
+	const unordered_map<string, list<string>::iterator>::iterator entry = cache->entries.find(key);
+	if(entry != cache->entries.end()) {
+	
+		// Make entry the most recently used
+		cache->keys.splice(cache->keys.begin(), cache->keys, entry->second);
+		
+		// Return false
+		return false;
 	}
 	
-	// Check if getting message hash from arguments failed
-	const tuple<uint8_t *, size_t, bool> messageHash = uint8ArrayToBuffer(environment, argv[0]);
-	if(!get<2>(messageHash)) {
+	// Check if cache is full
+	if(cache->keys.size() >= cache->capacity) {
 	
-		// Return operation failed
-		return OPERATION_FAILED;
+		// Remove least recently used entry from the cache
+		cache->entries.erase(cache->keys.back());
+		cache->keys.pop_back();
 	}
 	
-	// Check if getting secret key from arguments failed
-	const tuple<uint8_t *, size_t, bool> secretKey = uint8ArrayToBuffer(environment, argv[1]);
-	if(!get<2>(secretKey)) {
+	// Add key to the cache as the most recently used entry
+	cache->keys.push_front(key);
+	cache->entries.emplace(key, cache->keys.begin());
+	
+	// Return true
+	return true;
+}
+
+// Verification cache memory usage
+size_t verificationCacheMemoryUsage(VerificationCache *cache) {
+
+	// Return memory used by the cache's entries and hash table buckets
+	lock_guard<mutex> lock(cache->lock);
+	return cache->keys.size() * VERIFICATION_CACHE_ENTRY_MEMORY_USAGE + cache->entries.bucket_count() * sizeof(void *) + cache->salt.capacity();
+}
+
+// Get verification cache statistics
+napi_value getVerificationCacheStatistics(napi_env environment, VerificationCache *cache) {
+
+	// Check if creating result failed
+	napi_value result;
+	if(napi_create_object(environment, &result) != napi_ok) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
-	// Check if creating message hash signature failed
-	vector<uint8_t> signature(Secp256k1Zkp::maximumMessageHashSignatureSize(instanceData));
-	char signatureSize[MAX_64_BIT_INTEGER_STRING_LENGTH];
-	if(!Secp256k1Zkp::createMessageHashSignature(instanceData, signature.data(), signatureSize, get<0>(messageHash), get<1>(messageHash), get<0>(secretKey), get<1>(secretKey))) {
+	// Lock cache
+	lock_guard<mutex> lock(cache->lock);
 	
-		// Return operation failed
-		return OPERATION_FAILED;
+	// Go through all statistics
+	const array<tuple<const char *, int64_t>, 4> statistics = {{
+		{"Hits", static_cast<int64_t>(cache->hits)},
+		{"Misses", static_cast<int64_t>(cache->misses)},
+		{"Entries", static_cast<int64_t>(cache->keys.size())},
+		{"Capacity", static_cast<int64_t>(cache->capacity)}
+	}};
+	for(const tuple<const char *, int64_t> &statistic : statistics) {
+	
+		// Check if adding statistic to the result failed
+		napi_value temp;
+		if(napi_create_int64(environment, get<1>(statistic), &temp) != napi_ok || napi_set_named_property(environment, result, get<0>(statistic), temp) != napi_ok) {
+		
+			// Return operation failed
+			return operationFailed(environment);
+		}
 	}
 	
-	// Return signature as a uint8 array
-	return bufferToUint8Array(environment, signature.data(), strtoull(signatureSize, nullptr, 10));
+	// Return result
+	return result;
 }
 
-// Verify message hash signature
-napi_value verifyMessageHashSignature(napi_env environment, napi_callback_info arguments) {
+// Create secure arena
+uint8_t *createSecureArena(size_t size, bool &locked) {
 
-	// Check if getting instance data failed
-	InstanceData *instanceData = getInstanceData(environment);
-	if(!instanceData) {
+	// Check if using Windows
+	#ifdef _WIN32
 	
-		// Return false as a bool
-		return cBoolToBool(environment, false);
+		// Check if allocating memory for the secure arena failed
+		uint8_t *secureArena = reinterpret_cast<uint8_t *>(VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+		if(!secureArena) {
+		
+			// Return nothing
+			return nullptr;
+		}
+		
+		// Set locked to if locking the secure arena in memory was successful
+		locked = VirtualLock(secureArena, size);
+		
+	// Otherwise
+	#else
+	
+		// Check if allocating memory for the secure arena failed
+		void *secureArena = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if(secureArena == MAP_FAILED) {
+		
+			// Return nothing
+			return nullptr;
+		}
+		
+		// Set locked to if locking the secure arena in memory was successful
+		locked = !mlock(secureArena, size);
+		
+		// Check if excluding memory from core dumps is supported
+		#ifdef MADV_DONTDUMP
+		
+			// Exclude the secure arena from core dumps
+			madvise(secureArena, size, MADV_DONTDUMP);
+		#endif
+	#endif
+	
+	// Return secure arena
+	return reinterpret_cast<uint8_t *>(secureArena);
+}
+
+// Destroy secure arena
+void destroySecureArena(uint8_t *secureArena, size_t size, bool locked) {
+
+	// Clear secure arena
+	secureClear(secureArena, size);
+	
+	// Check if using Windows
+	#ifdef _WIN32
+	
+		// Check if secure arena is locked
+		if(locked) {
+		
+			// Unlock secure arena
+			VirtualUnlock(secureArena, size);
+		}
+		
+		// Free memory
+		VirtualFree(secureArena, 0, MEM_RELEASE);
+		
+	// Otherwise
+	#else
+	
+		// Check if secure arena is locked
+		if(locked) {
+		
+			// Unlock secure arena
+			munlock(secureArena, size);
+		}
+		
+		// Free memory
+		munmap(secureArena, size);
+	#endif
+}
+
+// Secure allocate
+uint8_t *secureAllocate(InstanceData *instanceData, size_t size) {
+
+	// Check if the size aligned to the secure arena's alignment overflows
+	const size_t alignedSize = (size + SECURE_ARENA_ALIGNMENT - 1) & ~(SECURE_ARENA_ALIGNMENT - 1);
+	if(alignedSize < size) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Check if the secure arena doesn't have enough space for the aligned size
+	if(alignedSize > SECURE_ARENA_SIZE - instanceData->secureArenaUsed) {
+	
+		// Check if creating a locked allocation just for the data failed
+		SecureOverflowAllocation secureOverflowAllocation = {nullptr, alignedSize, false, instanceData->secureArenaUsed};
+		secureOverflowAllocation.data = createSecureArena(alignedSize, secureOverflowAllocation.locked);
+		if(!secureOverflowAllocation.data) {
+		
+			// Return nothing
+			return nullptr;
+		}
+		
+		// Add allocation to the instance data's secure overflow allocations
+		instanceData->secureOverflowAllocations.push_back(secureOverflowAllocation);
+		
+		// Return data
+		return secureOverflowAllocation.data;
 	}
+	
+	// Get data from the end of the secure arena's used space
+	uint8_t *data = &instanceData->secureArena[instanceData->secureArenaUsed];
+	
+	// Update secure arena used
+	instanceData->secureArenaUsed += alignedSize;
+	
+	// Return data
+	return data;
+}
 
-	// Check if not enough arguments were provided
-	size_t argc = 3;
-	vector<napi_value> argv(argc);
-	if(napi_get_cb_info(environment, arguments, &argc, argv.data(), nullptr, nullptr) != napi_ok || argc != argv.size()) {
+// Secure free
+void secureFree(InstanceData *instanceData, uint8_t *data) {
+
+	// Check if data is in the secure arena
+	const bool inSecureArena = data >= instanceData->secureArena && data < instanceData->secureArena + SECURE_ARENA_SIZE;
+	size_t offset;
+	if(inSecureArena) {
 	
-		// Return false as a bool
-		return cBoolToBool(environment, false);
+		// Get data's offset in the secure arena
+		offset = data - instanceData->secureArena;
 	}
 	
-	// Check if getting signature from arguments failed
-	const tuple<uint8_t *, size_t, bool> signature = uint8ArrayToBuffer(environment, argv[0]);
-	if(!get<2>(signature)) {
+	// Otherwise
+	else {
 	
-		// Return false as a bool
-		return cBoolToBool(environment, false);
+		// Check if data isn't a secure overflow allocation since it was already released when something allocated before it was freed
+		const vector<SecureOverflowAllocation>::const_iterator secureOverflowAllocation = find_if(instanceData->secureOverflowAllocations.cbegin(), instanceData->secureOverflowAllocations.cend(), [data](const SecureOverflowAllocation &secureOverflowAllocation) -> bool {
+		
+			// Return if the allocation is the data
+			return secureOverflowAllocation.data == data;
+		});
+		if(secureOverflowAllocation == instanceData->secureOverflowAllocations.cend()) {
+		
+			// Return
+			return;
+		}
+		
+		// Get where the secure arena's used space ended when the data was allocated
+		offset = secureOverflowAllocation->secureArenaUsed;
 	}
 	
-	// Check if getting message hash from arguments failed
-	const tuple<uint8_t *, size_t, bool> messageHash = uint8ArrayToBuffer(environment, argv[1]);
-	if(!get<2>(messageHash)) {
+	// Check if data was already released when something allocated before it was freed
+	if(offset > instanceData->secureArenaUsed) {
 	
-		// Return false as a bool
-		return cBoolToBool(environment, false);
+		// Return
+		return;
 	}
 	
-	// Check if getting public key from arguments failed
-	const tuple<uint8_t *, size_t, bool> publicKey = uint8ArrayToBuffer(environment, argv[2]);
-	if(!get<2>(publicKey)) {
+	// Go through all secure overflow allocations from newest to oldest
+	while(!instanceData->secureOverflowAllocations.empty()) {
 	
-		// Return false as a bool
-		return cBoolToBool(environment, false);
+		// Check if data is in the secure arena and the allocation was made before it
+		const SecureOverflowAllocation secureOverflowAllocation = instanceData->secureOverflowAllocations.back();
+		if(inSecureArena && secureOverflowAllocation.secureArenaUsed <= offset) {
+		
+			// Break
+			break;
+		}
+		
+		// Destroy allocation since it's the data or was allocated after it
+		destroySecureArena(secureOverflowAllocation.data, secureOverflowAllocation.size, secureOverflowAllocation.locked);
+		instanceData->secureOverflowAllocations.pop_back();
+		
+		// Check if allocation was the data
+		if(secureOverflowAllocation.data == data) {
+		
+			// Break
+			break;
+		}
 	}
 	
-	// Check if message hash signature isn't verified
-	if(!Secp256k1Zkp::verifyMessageHashSignature(instanceData, get<0>(signature), get<1>(signature), get<0>(messageHash), get<1>(messageHash), get<0>(publicKey), get<1>(publicKey))) {
+	// Clear data and everything allocated after it in the secure arena
+	secureClear(&instanceData->secureArena[offset], instanceData->secureArenaUsed - offset);
 	
-		// Return false as a bool
-		return cBoolToBool(environment, false);
+	// Update secure arena used
+	instanceData->secureArenaUsed = offset;
+}
+
+// Secure clear
+void secureClear(void *data, size_t size) {
+
+	// Clear data using a volatile pointer to memset so that the compiler can't optimize it away
+	static void *(*const volatile secureMemset)(void *, int, size_t) = memset;
+	secureMemset(data, 0, size);
+}
+
+// Packed uint8 array to buffer
+tuple<uint8_t *, size_t, bool> packedUint8ArrayToBuffer(napi_env environment, napi_value uint8Array, size_t itemSize) {
+
+	// Check if getting uint8 array as a buffer failed or its size isn't a multiple of the item size
+	const tuple<uint8_t *, size_t, bool> buffer = uint8ArrayToBuffer(environment, uint8Array);
+	if(!get<2>(buffer) || get<1>(buffer) % itemSize) {
+	
+		// Return failure
+		return {nullptr, 0, false};
 	}
 	
-	// Return true as a bool
-	return cBoolToBool(environment, true);
+	// Return data and number of items
+	return {get<0>(buffer), get<1>(buffer) / itemSize, true};
 }
 
 // Uint8 array to buffer
@@ -2431,33 +7261,63 @@ napi_value bufferToUint8Array(napi_env environment, uint8_t *data, size_t size)
 	if(napi_create_arraybuffer(environment, size, reinterpret_cast<void **>(&arrayBufferData), &arrayBuffer) != napi_ok) {
 	
 		// Clear data
-		memset(data, 0, size);
+		secureClear(data, size);
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Copy data to array buffer
 	memcpy(arrayBufferData, data, size);
 	
 	// Clear data
-	memset(data, 0, size);
+	secureClear(data, size);
 	
 	// Check if creating uint8 array from array buffer failed
 	napi_value uint8Array;
 	if(napi_create_typedarray(environment, napi_uint8_array, size, arrayBuffer, 0, &uint8Array) != napi_ok) {
 	
 		// Clear array buffer
-		memset(arrayBufferData, 0, size);
+		secureClear(arrayBufferData, size);
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Return uint8 array
 	return uint8Array;
 }
 
+// Operation failed
+napi_value operationFailed(napi_env environment) {
+
+	// Check if getting null from the environment failed
+	napi_value result;
+	if(napi_get_null(environment, &result) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Return result
+	return result;
+}
+
+// Point at infinity
+napi_value pointAtInfinity(napi_env environment) {
+
+	// Check if getting false from the environment failed
+	napi_value result;
+	if(napi_get_boolean(environment, false, &result) != napi_ok) {
+	
+		// Return nothing
+		return nullptr;
+	}
+	
+	// Return result
+	return result;
+}
+
 // C bool to bool
 napi_value cBoolToBool(napi_env environment, bool value) {
 
@@ -2466,7 +7326,7 @@ napi_value cBoolToBool(napi_env environment, bool value) {
 	if(napi_get_boolean(environment, value, &result) != napi_ok) {
 	
 		// Return operation failed
-		return OPERATION_FAILED;
+		return operationFailed(environment);
 	}
 	
 	// Return result
@@ -2474,27 +7334,55 @@ napi_value cBoolToBool(napi_env environment, bool value) {
 }
 
 // String to C string
-tuple<string, bool> stringToCString(napi_env environment, napi_value value) {
+template<size_t size> bool stringToCString(napi_env environment, napi_value value, array<char, size> &result) {
 
-	// Check if getting the string's size failed
-	size_t size;
-	if(napi_get_value_string_utf8(environment, value, nullptr, 0, &size) != napi_ok) {
+	// Check if getting the string's size failed or it's too long for the result
+	size_t stringSize;
+	if(napi_get_value_string_utf8(environment, value, nullptr, 0, &stringSize) != napi_ok || stringSize >= result.size()) {
 	
-		// Return failure
-		return {"", false};
+		// Return false
+		return false;
 	}
 	
 	// Check if getting the string failed
-	vector<char> result(size + sizeof('\0'));
-	memset(result.data(), 0, result.size());
 	if(napi_get_value_string_utf8(environment, value, result.data(), result.size(), nullptr) != napi_ok) {
 	
-		// Return failure
-		return {"", false};
+		// Return false
+		return false;
 	}
 	
-	// Return result
-	return {result.data(), true};
+	// Return true
+	return true;
+}
+
+// String to uint64
+bool stringToUint64(napi_env environment, napi_value value, uint64_t &result) {
+
+	// Check if getting the string failed or it's empty
+	array<char, MAX_64_BIT_INTEGER_STRING_LENGTH> digits;
+	if(!stringToCString(environment, value, digits) || !digits[0]) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Go through all digits
+	result = 0;
+	for(size_t i = 0; digits[i]; ++i) {
+	
+		// Check if character isn't a digit or adding it to the result would overflow
+		if(digits[i] < '0' || digits[i] > '9' || result > (UINT64_MAX - (digits[i] - '0')) / 10) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Add character to the result
+		result = result * 10 + (digits[i] - '0');
+	}
+	
+	// Return true
+	return true;
 }
 
 // Random fill
@@ -2539,7 +7427,7 @@ bool randomFill(napi_env environment, uint8_t *buffer, size_t size) {
 	memcpy(buffer, data, size);
 	
 	// Clear data
-	memset(data, 0, size);
+	secureClear(data, size);
 	
 	// Return true
 	return true;
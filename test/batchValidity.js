@@ -0,0 +1,234 @@
+// Use strict
+"use strict";
+
+
+// Requires
+
+// Test
+const test = require("node:test");
+
+// Assert
+const assert = require("node:assert");
+
+// Crypto
+const crypto = require("crypto");
+
+// Secp256k1-zkp
+const secp256k1Zkp = require("../index.js");
+
+
+// Constants
+
+// Field prime
+const FIELD_PRIME = (1n << 256n) - (1n << 32n) - 977n;
+
+// Curve b
+const CURVE_B = 7n;
+
+// Field limb bits
+const FIELD_LIMB_BITS = 26n;
+
+// Number of random points
+const NUMBER_OF_RANDOM_POINTS = 256;
+
+// Number of rounds
+const NUMBER_OF_ROUNDS = 4;
+
+// Public key prefixes
+const PUBLIC_KEY_PREFIXES = [0x02, 0x03];
+
+// Commit prefixes
+const COMMIT_PREFIXES = [0x08, 0x09];
+
+
+// Supporting function implementation
+
+// Modular exponentiation
+const modularExponentiation = function(base, exponent, modulus) {
+
+	// Go through all of the exponent's bits
+	let result = 1n;
+	base %= modulus;
+	while(exponent > 0n) {
+	
+		// Check if bit is set
+		if(exponent & 1n) {
+		
+			// Multiply result by base
+			result = result * base % modulus;
+		}
+		
+		// Square base and move to the next bit
+		base = base * base % modulus;
+		exponent >>= 1n;
+	}
+	
+	// Return result
+	return result;
+};
+
+// Is valid x
+const isValidX = function(x) {
+
+	// Check if x isn't a field element
+	if(x >= FIELD_PRIME) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Return if x^3 + b is a square according to Euler's criterion
+	const curve = (x * x % FIELD_PRIME * x + CURVE_B) % FIELD_PRIME;
+	return curve === 0n || modularExponentiation(curve, (FIELD_PRIME - 1n) / 2n, FIELD_PRIME) === 1n;
+};
+
+// Big integer to bytes
+const bigIntToBytes = function(value) {
+
+	// Return value as 32 big-endian bytes
+	return new Uint8Array(Buffer.from(value.toString(16).padStart(64, "0"), "hex"));
+};
+
+// Bytes to big integer
+const bytesToBigInt = function(bytes) {
+
+	// Return bytes as a big-endian integer
+	return BigInt("0x" + Buffer.from(bytes).toString("hex"));
+};
+
+// Edge x components
+const edgeXComponents = function() {
+
+	// Add values around zero, the field prime, and the largest 256-bit value
+	const values = [0n, 1n, 2n, 7n, FIELD_PRIME - 2n, FIELD_PRIME - 1n, FIELD_PRIME, FIELD_PRIME + 1n, (1n << 256n) - 1n];
+	
+	// Go through all limb boundaries of the 10x26 representation
+	for(let bits = FIELD_LIMB_BITS; bits < 256n; bits += FIELD_LIMB_BITS) {
+	
+		// Add values with every limb below the boundary full, just past the boundary, and the prime minus the boundary which need carries and normalization
+		values.push((1n << bits) - 1n, 1n << bits, FIELD_PRIME - (1n << bits), FIELD_PRIME - (1n << bits) + 1n);
+	}
+	
+	// Add values with every limb full and alternating limbs full which produce the largest products
+	let allLimbs = 0n;
+	let alternatingLimbs = 0n;
+	for(let limb = 0n; limb < 10n; ++limb) {
+	
+		// Add limb
+		allLimbs |= ((1n << FIELD_LIMB_BITS) - 1n) << (limb * FIELD_LIMB_BITS);
+		alternatingLimbs |= (limb % 2n) ? 0n : ((1n << FIELD_LIMB_BITS) - 1n) << (limb * FIELD_LIMB_BITS);
+	}
+	values.push(allLimbs % (1n << 256n), alternatingLimbs % (1n << 256n), (alternatingLimbs >> 1n) % (1n << 256n), FIELD_PRIME - alternatingLimbs % FIELD_PRIME);
+	
+	// Return values
+	return values;
+};
+
+// Create points
+const createPoints = function(prefixes) {
+
+	// Go through all edge x components with each prefix
+	const points = [];
+	for(const x of edgeXComponents()) {
+	
+		// Go through all prefixes
+		for(const prefix of prefixes) {
+		
+			// Add point
+			points.push(Uint8Array.from([prefix, ...bigIntToBytes(x % (1n << 256n))]));
+		}
+	}
+	
+	// Go through all random points
+	for(let i = 0; i < NUMBER_OF_RANDOM_POINTS; ++i) {
+	
+		// Check if creating a point that's on the curve
+		if(i % 2) {
+		
+			// Add public key's x component with the prefix since the x components of public keys and commits are both on the curve
+			const publicKey = secp256k1Zkp["publicKeyFromSecretKey"](new Uint8Array(crypto.randomBytes(32)));
+			points.push(Uint8Array.from([prefixes[publicKey[0] & 1], ...publicKey.subarray(1)]));
+		}
+		
+		// Otherwise
+		else {
+		
+			// Add random point which is on the curve about half of the time
+			points.push(Uint8Array.from([prefixes[i % 4 >> 1], ...crypto.randomBytes(32)]));
+		}
+	}
+	
+	// Add points with invalid prefixes
+	points.push(Uint8Array.from([0x04, ...points[points.length - 1].subarray(1)]), Uint8Array.from([0x00, ...points[points.length - 1].subarray(1)]), Uint8Array.from([prefixes[0] ^ 0x0A, ...points[points.length - 1].subarray(1)]));
+	
+	// Return points
+	return points;
+};
+
+// Shuffle
+const shuffle = function(values) {
+
+	// Go through all values
+	for(let i = values.length - 1; i > 0; --i) {
+	
+		// Swap value with a random earlier value
+		const j = crypto.randomInt(i + 1);
+		[values[i], values[j]] = [values[j], values[i]];
+	}
+	
+	// Return values
+	return values;
+};
+
+// Check batch
+const checkBatch = function(points, prefixes, areValid, isValid) {
+
+	// Pack points
+	const packed = new Uint8Array(points.length * 33);
+	for(let i = 0; i < points.length; ++i) {
+	
+		// Add point to the packed points
+		packed.set(points[i], i * 33);
+	}
+	
+	// Check that the batched results match the scalar library results and the big integer oracle for every point
+	const results = areValid(packed);
+	assert.strictEqual(results.length, Math.ceil(points.length / 8));
+	for(let i = 0; i < points.length; ++i) {
+	
+		// Get expected result
+		const expected = prefixes.includes(points[i][0]) && isValidX(bytesToBigInt(points[i].subarray(1)));
+		
+		// Check that the batched result, the scalar result, and the expected result are the same
+		const batched = (results[i >> 3] & (1 << (i & 7))) !== 0;
+		assert.strictEqual(isValid(points[i]), expected, "scalar " + Buffer.from(points[i]).toString("hex"));
+		assert.strictEqual(batched, expected, "batched " + Buffer.from(points[i]).toString("hex"));
+	}
+};
+
+
+// Tests
+
+// Public keys
+test("areValidPublicKeys matches isValidPublicKey and big integer arithmetic on random and edge case x components", function() {
+
+	// Go through all rounds
+	for(let round = 0; round < NUMBER_OF_ROUNDS; ++round) {
+	
+		// Check shuffled points with a length that doesn't fill every lane group
+		const points = shuffle(createPoints(PUBLIC_KEY_PREFIXES));
+		checkBatch(points.slice(0, points.length - round), PUBLIC_KEY_PREFIXES, secp256k1Zkp["areValidPublicKeys"], secp256k1Zkp["isValidPublicKey"]);
+	}
+});
+
+// Commits
+test("areValidCommits matches isValidCommit and big integer arithmetic on random and edge case x components", function() {
+
+	// Go through all rounds
+	for(let round = 0; round < NUMBER_OF_ROUNDS; ++round) {
+	
+		// Check shuffled points with a length that doesn't fill every lane group
+		const points = shuffle(createPoints(COMMIT_PREFIXES));
+		checkBatch(points.slice(0, points.length - round), COMMIT_PREFIXES, secp256k1Zkp["areValidCommits"], secp256k1Zkp["isValidCommit"]);
+	}
+});
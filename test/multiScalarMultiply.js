@@ -0,0 +1,61 @@
+// Use strict
+"use strict";
+
+
+// Requires
+
+// Test
+const test = require("node:test");
+
+// Assert
+const assert = require("node:assert");
+
+// Crypto
+const crypto = require("crypto");
+
+// Secp256k1-zkp
+const secp256k1Zkp = require("../index.js");
+
+
+// Constants
+
+// Scalar one
+const SCALAR_ONE = new Uint8Array(32).fill(1, 31);
+
+// Scalar negative one which is the curve order minus one
+const SCALAR_NEGATIVE_ONE = new Uint8Array(Buffer.from("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364140", "hex"));
+
+// Scalar two
+const SCALAR_TWO = new Uint8Array(32).fill(2, 31);
+
+
+// Tests
+
+// Multi-scalar multiply to infinity
+test("multiScalarMultiply returns POINT_AT_INFINITY when the points cancel out", function() {
+
+	// Get random public key
+	const publicKey = secp256k1Zkp["publicKeyFromSecretKey"](new Uint8Array(crypto.randomBytes(32)));
+	
+	// Check that the public key minus itself is the point at infinity and not a failure
+	const result = secp256k1Zkp["multiScalarMultiply"]([publicKey, publicKey], [SCALAR_ONE, SCALAR_NEGATIVE_ONE]);
+	assert.strictEqual(result, secp256k1Zkp["POINT_AT_INFINITY"]);
+	assert.notStrictEqual(result, secp256k1Zkp["OPERATION_FAILED"]);
+});
+
+// Multi-scalar multiply commits
+test("multiScalarMultiply accepts commits and returns a commit", function() {
+
+	// Get random blind and its commit
+	const blind = new Uint8Array(crypto.randomBytes(32));
+	const commit = secp256k1Zkp["pedersenCommit"](blind, "1");
+	
+	// Check that the commit plus itself is the same as the commit multiplied by two
+	assert.deepStrictEqual(secp256k1Zkp["multiScalarMultiply"]([commit, commit], [SCALAR_ONE, SCALAR_ONE]), secp256k1Zkp["pedersenCommit"](secp256k1Zkp["blindSum"]([blind, blind], []), "2"));
+	assert.deepStrictEqual(secp256k1Zkp["multiScalarMultiply"]([commit], [SCALAR_TWO]), secp256k1Zkp["pedersenCommit"](secp256k1Zkp["blindSum"]([blind, blind], []), "2"));
+	
+	// Check that mixing a commit with a public key returns a public key
+	const publicKey = secp256k1Zkp["publicKeyFromSecretKey"](blind);
+	assert.strictEqual(secp256k1Zkp["multiScalarMultiply"]([commit, publicKey], [SCALAR_ONE, SCALAR_ONE]).length, 33);
+	assert.notStrictEqual(secp256k1Zkp["multiScalarMultiply"]([commit, publicKey], [SCALAR_ONE, SCALAR_ONE])[0] & 0xFE, 0x08);
+});
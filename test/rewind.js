@@ -0,0 +1,263 @@
+// Use strict
+"use strict";
+
+
+// Requires
+
+// Test
+const test = require("node:test");
+
+// Assert
+const assert = require("node:assert");
+
+// Crypto
+const crypto = require("crypto");
+
+// Secp256k1-zkp
+const secp256k1Zkp = require("../index.js");
+
+
+// Constants
+
+// Values which include zero and the largest 64-bit value
+const VALUES = ["0", "1", "1000", "4294967296", "18446744073709551615"];
+
+// Message size
+const MESSAGE_SIZE = 20;
+
+// Commit size
+const COMMIT_SIZE = 33;
+
+// Number of scanned proofs which spans several precheck batches of 64 proofs and ends with a partial one
+const NUMBER_OF_SCANNED_PROOFS = 150;
+
+// Owned proof indices at the start and end of precheck batches and in the last partial batch
+const OWNED_PROOF_INDICES = [0, 63, 64, 100, 149];
+
+// Number of other outputs
+const NUMBER_OF_OTHER_OUTPUTS = 4;
+
+
+// Supporting function implementation
+
+// Random bytes
+const randomBytes = function(size) {
+
+	// Return random bytes
+	return new Uint8Array(crypto.randomBytes(size));
+};
+
+// Create output
+const createOutput = function(nonce, value) {
+
+	// Create blind and message
+	const blind = randomBytes(32);
+	const message = randomBytes(MESSAGE_SIZE);
+	
+	// Return output's proof, commit, blind, value, and message
+	return {
+	
+		// Proof
+		"Proof": secp256k1Zkp["createBulletproof"](blind, value, nonce, randomBytes(32), new Uint8Array([]), message),
+		
+		// Commit
+		"Commit": secp256k1Zkp["pedersenCommit"](blind, value),
+		
+		// Blind
+		"Blind": blind,
+		
+		// Value
+		"Value": value,
+		
+		// Message
+		"Message": message
+	};
+};
+
+
+// Tests
+
+// Rewind context rewind
+test("RewindContext.rewind returns the same value, blind, and message as rewindBulletproof", function() {
+
+	// Create rewind context
+	const nonce = randomBytes(32);
+	const rewindContext = secp256k1Zkp["createRewindContext"](nonce);
+	
+	// Go through all values
+	for(const value of VALUES) {
+	
+		// Create output with the rewind context's nonce
+		const output = createOutput(nonce, value);
+		
+		// Check that rewinding the proof with the nonce recovers the output's value, blind, and message
+		const expected = secp256k1Zkp["rewindBulletproof"](output["Proof"], output["Commit"], nonce);
+		assert.notStrictEqual(expected, secp256k1Zkp["OPERATION_FAILED"]);
+		assert.strictEqual(expected["Value"], output["Value"]);
+		assert.deepStrictEqual(expected["Blind"], output["Blind"]);
+		assert.deepStrictEqual(expected["Message"], output["Message"]);
+		
+		// Check that rewinding the proof with the rewind context returns the same result
+		assert.deepStrictEqual(rewindContext["rewind"](output["Proof"], output["Commit"]), expected);
+	}
+});
+
+// Rewind context rewind other proofs
+test("RewindContext.rewind and rewindBulletproof fail for proofs that aren't owned or a wrong commit", function() {
+
+	// Create rewind context
+	const nonce = randomBytes(32);
+	const rewindContext = secp256k1Zkp["createRewindContext"](nonce);
+	
+	// Go through all values
+	for(const value of VALUES) {
+	
+		// Check that a proof created with another nonce can't be rewound
+		const otherOutput = createOutput(randomBytes(32), value);
+		assert.strictEqual(secp256k1Zkp["rewindBulletproof"](otherOutput["Proof"], otherOutput["Commit"], nonce), secp256k1Zkp["OPERATION_FAILED"]);
+		assert.strictEqual(rewindContext["rewind"](otherOutput["Proof"], otherOutput["Commit"]), secp256k1Zkp["OPERATION_FAILED"]);
+		
+		// Check that an owned proof can't be rewound with another output's commit
+		const output = createOutput(nonce, value);
+		assert.strictEqual(secp256k1Zkp["rewindBulletproof"](output["Proof"], otherOutput["Commit"], nonce), secp256k1Zkp["OPERATION_FAILED"]);
+		assert.strictEqual(rewindContext["rewind"](output["Proof"], otherOutput["Commit"]), secp256k1Zkp["OPERATION_FAILED"]);
+	}
+});
+
+// Can rewind bulletproof
+test("canRewindBulletproof is true for every proof rewindBulletproof recovers and false for random proofs", function() {
+
+	// Create nonce
+	const nonce = randomBytes(32);
+	
+	// Go through all values
+	for(const value of VALUES) {
+	
+		// Check that an owned proof that can be rewound passes the precheck
+		const output = createOutput(nonce, value);
+		assert.notStrictEqual(secp256k1Zkp["rewindBulletproof"](output["Proof"], output["Commit"], nonce), secp256k1Zkp["OPERATION_FAILED"]);
+		assert.strictEqual(secp256k1Zkp["canRewindBulletproof"](output["Proof"], output["Commit"], nonce), true);
+		
+		// Check that a proof created with another nonce fails the precheck
+		const otherOutput = createOutput(randomBytes(32), value);
+		assert.strictEqual(secp256k1Zkp["canRewindBulletproof"](otherOutput["Proof"], otherOutput["Commit"], nonce), false);
+		
+		// Check that random bytes the size of a proof fail the precheck
+		assert.strictEqual(secp256k1Zkp["canRewindBulletproof"](randomBytes(output["Proof"].length), output["Commit"], nonce), false);
+	}
+});
+
+// Rewind context scan
+test("RewindContext.scan finds owned proofs at their indices across precheck batches and reports all proofs processed", async function() {
+
+	// Create rewind context
+	const nonce = randomBytes(32);
+	const rewindContext = secp256k1Zkp["createRewindContext"](nonce);
+	
+	// Create proofs that aren't owned
+	const otherOutputs = [];
+	for(let i = 0; i < NUMBER_OF_OTHER_OUTPUTS; ++i) {
+	
+		// Add output created with another nonce
+		otherOutputs.push(createOutput(randomBytes(32), VALUES[i % VALUES.length]));
+	}
+	
+	// Go through all proofs
+	const ownedOutputs = new Map();
+	const proofs = [];
+	const commits = new Uint8Array(NUMBER_OF_SCANNED_PROOFS * COMMIT_SIZE);
+	for(let i = 0; i < NUMBER_OF_SCANNED_PROOFS; ++i) {
+	
+		// Check if proof is owned
+		let output;
+		if(OWNED_PROOF_INDICES.indexOf(i) !== -1) {
+		
+			// Create owned output
+			output = createOutput(nonce, VALUES[ownedOutputs.size % VALUES.length]);
+			ownedOutputs.set(i, output);
+		}
+		
+		// Otherwise
+		else {
+		
+			// Use an output that isn't owned
+			output = otherOutputs[i % NUMBER_OF_OTHER_OUTPUTS];
+		}
+		
+		// Add output's proof and commit
+		proofs.push(output["Proof"]);
+		commits.set(output["Commit"], i * COMMIT_SIZE);
+	}
+	
+	// Scan proofs
+	const results = [];
+	let processed = 0;
+	const result = await rewindContext["scan"](proofs, commits, function(numberOfProofsProcessed, scanResult) {
+	
+		// Check if a proof was found
+		if(scanResult !== null) {
+		
+			// Add result
+			results.push(scanResult);
+		}
+		
+		// Otherwise
+		else {
+		
+			// Set number of proofs processed
+			processed = numberOfProofsProcessed;
+		}
+	});
+	
+	// Check that scan completed and processed all proofs
+	assert.strictEqual(result, true);
+	assert.strictEqual(processed, NUMBER_OF_SCANNED_PROOFS);
+	
+	// Check that only the owned proofs were found in order with their values, blinds, and messages
+	assert.deepStrictEqual(results.map(function(scanResult) {
+	
+		// Return result's index
+		return scanResult["Index"];
+		
+	}), OWNED_PROOF_INDICES);
+	for(const scanResult of results) {
+	
+		// Check that result is the owned output
+		const output = ownedOutputs.get(scanResult["Index"]);
+		assert.strictEqual(scanResult["Value"], output["Value"]);
+		assert.deepStrictEqual(scanResult["Blind"], output["Blind"]);
+		assert.deepStrictEqual(scanResult["Message"], output["Message"]);
+	}
+});
+
+// Rewind context scan abort
+test("RewindContext.scan resolves to operation failed when aborted", async function() {
+
+	// Create rewind context
+	const nonce = randomBytes(32);
+	const rewindContext = secp256k1Zkp["createRewindContext"](nonce);
+	
+	// Create proofs which are all owned
+	const output = createOutput(nonce, VALUES[1]);
+	const proofs = new Array(NUMBER_OF_SCANNED_PROOFS).fill(output["Proof"]);
+	const commits = new Uint8Array(NUMBER_OF_SCANNED_PROOFS * COMMIT_SIZE);
+	for(let i = 0; i < NUMBER_OF_SCANNED_PROOFS; ++i) {
+	
+		// Add output's commit
+		commits.set(output["Commit"], i * COMMIT_SIZE);
+	}
+	
+	// Check that a scan with an already aborted signal fails
+	const abortedController = new AbortController();
+	abortedController.abort();
+	assert.strictEqual(await rewindContext["scan"](proofs, commits, function() {}, abortedController["signal"]), secp256k1Zkp["OPERATION_FAILED"]);
+	
+	// Check that a scan aborted when its first result is received fails
+	const abortController = new AbortController();
+	assert.strictEqual(await rewindContext["scan"](proofs, commits, function() {
+	
+		// Abort scan
+		abortController.abort();
+		
+	}, abortController["signal"]), secp256k1Zkp["OPERATION_FAILED"]);
+});
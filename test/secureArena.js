@@ -0,0 +1,100 @@
+// Use strict
+"use strict";
+
+
+// Requires
+
+// Test
+const test = require("node:test");
+
+// Assert
+const assert = require("node:assert");
+
+// Crypto
+const crypto = require("crypto");
+
+// Secp256k1-zkp
+const secp256k1Zkp = require("../index.js");
+
+
+// Constants
+
+// Number of inputs which uses more than the secure arena's size
+const NUMBER_OF_INPUTS = 2100;
+
+// Chunk size which fits in the secure arena
+const CHUNK_SIZE = 100;
+
+
+// Supporting function implementation
+
+// Scalar from number
+const scalarFromNumber = function(number) {
+
+	// Return number as a big-endian scalar
+	const scalar = new Uint8Array(32);
+	new DataView(scalar.buffer).setUint32(scalar.length - Uint32Array.BYTES_PER_ELEMENT, number);
+	return scalar;
+};
+
+
+// Tests
+
+// Blind sum with more blinds than fit in the secure arena
+test("blindSum works with more than 2048 blinds", function() {
+
+	// Create random positive and negative blinds
+	const positiveBlinds = Array.from({"length": NUMBER_OF_INPUTS / 2}, function() {
+	
+		// Return random blind
+		return new Uint8Array(crypto.randomBytes(32));
+	});
+	const negativeBlinds = Array.from({"length": NUMBER_OF_INPUTS / 2}, function() {
+	
+		// Return random blind
+		return new Uint8Array(crypto.randomBytes(32));
+	});
+	
+	// Get the sum of all blinds at once
+	const result = secp256k1Zkp["blindSum"](positiveBlinds, negativeBlinds);
+	assert.notStrictEqual(result, secp256k1Zkp["OPERATION_FAILED"]);
+	
+	// Go through all chunks of the blinds
+	let expected = null;
+	for(let i = 0; i < positiveBlinds.length; i += CHUNK_SIZE) {
+	
+		// Add chunk to the expected sum
+		expected = secp256k1Zkp["blindSum"]((expected === null) ? positiveBlinds.slice(i, i + CHUNK_SIZE) : [expected, ...positiveBlinds.slice(i, i + CHUNK_SIZE)], negativeBlinds.slice(i, i + CHUNK_SIZE));
+		assert.notStrictEqual(expected, secp256k1Zkp["OPERATION_FAILED"]);
+	}
+	
+	// Check that the sum is the same as summing it in chunks
+	assert.deepStrictEqual(result, expected);
+});
+
+// Multi-scalar multiply with more scalars than fit in the secure arena
+test("multiScalarMultiply works with more than 2048 scalars", function() {
+
+	// Get random public key
+	const publicKey = secp256k1Zkp["publicKeyFromSecretKey"](new Uint8Array(crypto.randomBytes(32)));
+	
+	// Check that adding the public key to itself many times is the same as multiplying it by the number of times
+	const result = secp256k1Zkp["multiScalarMultiply"](new Array(NUMBER_OF_INPUTS).fill(publicKey), new Array(NUMBER_OF_INPUTS).fill(scalarFromNumber(1)));
+	assert.notStrictEqual(result, secp256k1Zkp["OPERATION_FAILED"]);
+	assert.deepStrictEqual(result, secp256k1Zkp["multiScalarMultiply"]([publicKey], [scalarFromNumber(NUMBER_OF_INPUTS)]));
+});
+
+// Secure arena after large allocations
+test("secure arena is released after more than 2048 blinds", function() {
+
+	// Sum more blinds than fit in the secure arena
+	const blinds = Array.from({"length": NUMBER_OF_INPUTS}, function() {
+	
+		// Return random blind
+		return new Uint8Array(crypto.randomBytes(32));
+	});
+	assert.notStrictEqual(secp256k1Zkp["blindSum"](blinds, []), secp256k1Zkp["OPERATION_FAILED"]);
+	
+	// Check that the secure arena's memory usage doesn't include the overflow allocation afterwards
+	assert.strictEqual(secp256k1Zkp["getMemoryUsage"]()["SecureArena"], 64 * 1024);
+});
@@ -0,0 +1,68 @@
+// Use strict
+"use strict";
+
+
+// Requires
+
+// Test
+const test = require("node:test");
+
+// Assert
+const assert = require("node:assert");
+
+// Crypto
+const crypto = require("crypto");
+
+// Secp256k1-zkp
+const secp256k1Zkp = require("../index.js");
+
+
+// Constants
+
+// Message sizes around the padding boundaries where the length no longer fits in the last block and multiples of the block size
+const MESSAGE_SIZES = [1, 55, 56, 63, 64, 65, 97, 119, 120, 128];
+
+// Maximum number of messages which covers one full group of lanes and every partial group after it
+const MAXIMUM_NUMBER_OF_MESSAGES = 16;
+
+// Number of rounds
+const NUMBER_OF_ROUNDS = 4;
+
+
+// Tests
+
+// SHA-256 multiple
+test("sha256Multiple matches crypto's SHA-256 for every lane count and message sizes around the padding boundaries", function() {
+
+	// Go through all rounds
+	for(let round = 0; round < NUMBER_OF_ROUNDS; ++round) {
+	
+		// Go through all message sizes
+		for(const messageSize of MESSAGE_SIZES) {
+		
+			// Go through all numbers of messages
+			for(let numberOfMessages = 1; numberOfMessages <= MAXIMUM_NUMBER_OF_MESSAGES; ++numberOfMessages) {
+			
+				// Create random messages
+				const messages = new Uint8Array(crypto.randomBytes(messageSize * numberOfMessages));
+				
+				// Check that every lane's hash is the same as crypto's hash of its message
+				const hashes = secp256k1Zkp["sha256Multiple"](messages, messageSize);
+				assert.strictEqual(hashes.length, numberOfMessages * 32);
+				for(let i = 0; i < numberOfMessages; ++i) {
+				
+					// Check that lane's hash is the same as crypto's hash
+					assert.strictEqual(Buffer.from(hashes.subarray(i * 32, (i + 1) * 32)).toString("hex"), crypto.createHash("sha256").update(messages.subarray(i * messageSize, (i + 1) * messageSize)).digest("hex"), messageSize.toString() + " byte message in lane " + (i % 8).toString() + " of " + numberOfMessages.toString() + " messages");
+				}
+			}
+		}
+	}
+});
+
+// SHA-256 multiple with an invalid message size
+test("sha256Multiple fails when the messages aren't a multiple of the message size", function() {
+
+	// Check that messages that aren't a multiple of the message size or a zero message size fail
+	assert.strictEqual(secp256k1Zkp["sha256Multiple"](new Uint8Array(65), 64), secp256k1Zkp["OPERATION_FAILED"]);
+	assert.strictEqual(secp256k1Zkp["sha256Multiple"](new Uint8Array(64), 0), secp256k1Zkp["OPERATION_FAILED"]);
+});
@@ -0,0 +1,168 @@
+// Use strict
+"use strict";
+
+
+// Requires
+
+// Test
+const test = require("node:test");
+
+// Assert
+const assert = require("node:assert");
+
+// Crypto
+const crypto = require("crypto");
+
+// Secp256k1-zkp
+const secp256k1Zkp = require("../index.js");
+
+
+// Constants
+
+// Number of participants
+const NUMBER_OF_PARTICIPANTS = 3;
+
+// Number of rounds which covers public nonce totals with and without a quadratic residue y component
+const NUMBER_OF_ROUNDS = 8;
+
+
+// Supporting function implementation
+
+// Pack
+const pack = function(values) {
+
+	// Go through all values
+	const packed = new Uint8Array(values.reduce(function(size, value) {
+	
+		// Return size with the value's size
+		return size + value.length;
+		
+	}, 0));
+	let offset = 0;
+	for(const value of values) {
+	
+		// Add value to the packed values
+		packed.set(value, offset);
+		offset += value.length;
+	}
+	
+	// Return packed values
+	return packed;
+};
+
+// Create participants
+const createParticipants = function() {
+
+	// Go through all participants
+	const participants = [];
+	for(let i = 0; i < NUMBER_OF_PARTICIPANTS; ++i) {
+	
+		// Create participant's secret key and secret nonce
+		const secretKey = new Uint8Array(crypto.randomBytes(32));
+		const secretNonce = secp256k1Zkp["createSecretNonce"]();
+		
+		// Add participant
+		participants.push({
+		
+			// Secret key
+			"Secret Key": secretKey,
+			
+			// Secret nonce
+			"Secret Nonce": secretNonce,
+			
+			// Public key
+			"Public Key": secp256k1Zkp["publicKeyFromSecretKey"](secretKey),
+			
+			// Public nonce
+			"Public Nonce": secp256k1Zkp["publicKeyFromSecretKey"](secretNonce)
+		});
+	}
+	
+	// Return participants
+	return participants;
+};
+
+// Create signing session
+const createSigningSession = function(participants) {
+
+	// Return signing session for a random message with the participants' public keys and public nonces
+	return secp256k1Zkp["createSigningSession"](new Uint8Array(crypto.randomBytes(32)), pack(participants.map(function(participant) {
+	
+		// Return participant's public key
+		return participant["Public Key"];
+		
+	})), pack(participants.map(function(participant) {
+	
+		// Return participant's public nonce
+		return participant["Public Nonce"];
+	})));
+};
+
+
+// Tests
+
+// Valid partial signatures
+test("verifyPartialSignatures returns -1 when every partial signature is valid", function() {
+
+	// Go through all rounds
+	for(let round = 0; round < NUMBER_OF_ROUNDS; ++round) {
+	
+		// Create partial signatures
+		const participants = createParticipants();
+		const signingSession = createSigningSession(participants);
+		const partialSignatures = participants.map(function(participant) {
+		
+			// Return participant's partial signature
+			return signingSession["createPartialSignature"](participant["Secret Key"], participant["Secret Nonce"]);
+		});
+		
+		// Check that every partial signature is valid by itself and together and that they add up to a valid signature
+		for(let i = 0; i < NUMBER_OF_PARTICIPANTS; ++i) {
+		
+			// Check that partial signature is valid
+			assert.strictEqual(signingSession["verifyPartialSignature"](partialSignatures[i], i), true);
+		}
+		assert.strictEqual(signingSession["verifyPartialSignatures"](pack(partialSignatures)), -1);
+		assert.strictEqual(signingSession["verifySignature"](signingSession["addPartialSignatures"](pack(partialSignatures))), true);
+	}
+});
+
+// Invalid partial signatures
+test("verifyPartialSignatures returns the index of a corrupted partial signature or one with a flipped nonce sign", function() {
+
+	// Go through all rounds
+	for(let round = 0; round < NUMBER_OF_ROUNDS; ++round) {
+	
+		// Create partial signatures
+		const participants = createParticipants();
+		const signingSession = createSigningSession(participants);
+		const partialSignatures = participants.map(function(participant) {
+		
+			// Return participant's partial signature
+			return signingSession["createPartialSignature"](participant["Secret Key"], participant["Secret Nonce"]);
+		});
+		
+		// Corrupt the second participant's partial signature's s component
+		const corruptedIndex = 1;
+		const corruptedPartialSignature = partialSignatures[corruptedIndex].slice();
+		corruptedPartialSignature[corruptedPartialSignature.length - 1] ^= 0x01;
+		
+		// Create the last participant's partial signature with the negated secret nonce which has the same r component but the opposite nonce sign
+		const flippedIndex = NUMBER_OF_PARTICIPANTS - 1;
+		const flippedPartialSignature = signingSession["createPartialSignature"](participants[flippedIndex]["Secret Key"], secp256k1Zkp["blindSum"]([], [participants[flippedIndex]["Secret Nonce"]]));
+		assert.deepStrictEqual(flippedPartialSignature.subarray(0, 32), partialSignatures[flippedIndex].subarray(0, 32));
+		
+		// Check that both invalid partial signatures fail by themselves
+		assert.strictEqual(signingSession["verifyPartialSignature"](corruptedPartialSignature, corruptedIndex), false);
+		assert.strictEqual(signingSession["verifyPartialSignature"](flippedPartialSignature, flippedIndex), false);
+		
+		// Check that the corrupted partial signature's index is reported
+		assert.strictEqual(signingSession["verifyPartialSignatures"](pack([partialSignatures[0], corruptedPartialSignature, partialSignatures[2]])), corruptedIndex);
+		
+		// Check that the flipped partial signature's index is reported and not that all partial signatures are valid
+		assert.strictEqual(signingSession["verifyPartialSignatures"](pack([partialSignatures[0], partialSignatures[1], flippedPartialSignature])), flippedIndex);
+		
+		// Check that the first invalid partial signature's index is reported when there are both
+		assert.strictEqual(signingSession["verifyPartialSignatures"](pack([partialSignatures[0], corruptedPartialSignature, flippedPartialSignature])), corruptedIndex);
+	}
+});
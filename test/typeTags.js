@@ -0,0 +1,85 @@
+// Use strict
+"use strict";
+
+
+// Requires
+
+// Test
+const test = require("node:test");
+
+// Assert
+const assert = require("node:assert");
+
+// Crypto
+const crypto = require("crypto");
+
+// Secp256k1-zkp
+const secp256k1Zkp = require("../index.js");
+
+
+// Supporting function implementation
+
+// Create signing session
+const createSigningSession = function() {
+
+	// Get random public key and public nonce
+	const publicKey = secp256k1Zkp["publicKeyFromSecretKey"](new Uint8Array(crypto.randomBytes(32)));
+	const publicNonce = secp256k1Zkp["publicKeyFromSecretKey"](new Uint8Array(crypto.randomBytes(32)));
+	
+	// Return signing session for a random message
+	return secp256k1Zkp["createSigningSession"](new Uint8Array(crypto.randomBytes(32)), publicKey, publicNonce);
+};
+
+
+// Tests
+
+// Signing session methods with another object
+test("signing session methods throw a TypeError for other objects", function() {
+
+	// Create signing session and rewind context
+	const signingSession = createSigningSession();
+	const rewindContext = secp256k1Zkp["createRewindContext"](new Uint8Array(crypto.randomBytes(32)));
+	
+	// Check that calling a signing session method on a signing session works
+	assert.strictEqual(signingSession["getPublicKeyTotal"]().length, 33);
+	
+	// Check that calling a signing session method on a rewind context or a plain object throws a type error
+	assert.throws(function() {
+	
+		// Call signing session method on the rewind context
+		signingSession["getPublicKeyTotal"].call(rewindContext);
+		
+	}, TypeError);
+	assert.throws(function() {
+	
+		// Call signing session method on a plain object
+		signingSession["getPublicKeyTotal"].call({});
+		
+	}, TypeError);
+});
+
+// Rewind context methods with another object
+test("rewind context methods throw a TypeError for other objects", function() {
+
+	// Create signing session and rewind context
+	const signingSession = createSigningSession();
+	const rewindContext = secp256k1Zkp["createRewindContext"](new Uint8Array(crypto.randomBytes(32)));
+	
+	// Go through all of the rewind context's methods and their arguments
+	for(const [method, methodArguments] of [["canRewind", [new Uint8Array(0), new Uint8Array(0)]], ["rewind", [new Uint8Array(0), new Uint8Array(0)]], ["scan", [[], new Uint8Array(0), function() {}]]]) {
+	
+		// Check that calling the method on a signing session or a plain object throws a type error
+		assert.throws(function() {
+		
+			// Call rewind context method on the signing session
+			rewindContext[method].call(signingSession, ...methodArguments);
+			
+		}, TypeError);
+		assert.throws(function() {
+		
+			// Call rewind context method on a plain object
+			rewindContext[method].call({}, ...methodArguments);
+			
+		}, TypeError);
+	}
+});
@@ -0,0 +1,257 @@
+// Use strict
+"use strict";
+
+
+// Requires
+
+// Test
+const test = require("node:test");
+
+// Assert
+const assert = require("node:assert");
+
+// Crypto
+const crypto = require("crypto");
+
+// Secp256k1-zkp
+const secp256k1Zkp = require("../index.js");
+
+
+// Constants
+
+// Input value
+const INPUT_VALUE = "100";
+
+// Block output value which is the input value plus the reward
+const BLOCK_OUTPUT_VALUE = "160";
+
+// Reward
+const REWARD = "60";
+
+// Transaction output value which is the input value minus the fee
+const TRANSACTION_OUTPUT_VALUE = "90";
+
+// Fee
+const FEE = "10";
+
+// Number of kernels which is more than one batch of kernels
+const NUMBER_OF_KERNELS = 70;
+
+
+// Supporting function implementation
+
+// Create blind
+const createBlind = function() {
+
+	// Return random blind
+	return new Uint8Array(crypto.randomBytes(32));
+};
+
+// Create output
+const createOutput = function(blind, value) {
+
+	// Return output's commit and proof
+	return {
+	
+		// Commit
+		"Commit": secp256k1Zkp["pedersenCommit"](blind, value),
+		
+		// Proof
+		"Proof": secp256k1Zkp["createBulletproof"](blind, value, createBlind(), createBlind(), new Uint8Array([]), new Uint8Array(20))
+	};
+};
+
+// Create kernel
+const createKernel = function(excessBlind) {
+
+	// Get random message
+	const message = new Uint8Array(crypto.randomBytes(32));
+	
+	// Return kernel's excess, signature, and message
+	return {
+	
+		// Excess
+		"Excess": secp256k1Zkp["pedersenCommit"](excessBlind, "0"),
+		
+		// Signature
+		"Signature": secp256k1Zkp["createSingleSignerSignature"](message, excessBlind, null, secp256k1Zkp["publicKeyFromSecretKey"](excessBlind), null, null),
+		
+		// Message
+		"Message": message
+	};
+};
+
+// Create body
+const createBody = function(outputValue, kernelOffset, invertedExcess = false) {
+
+	// Create input and output blinds
+	const inputBlind = createBlind();
+	const outputBlind = createBlind();
+	
+	// Get excess blind so that the output minus the input is the excess plus the kernel offset like wallets on the chain create it or the negation of that if creating an inverted excess
+	const excessBlind = invertedExcess ? secp256k1Zkp["blindSum"]([inputBlind, kernelOffset], [outputBlind]) : secp256k1Zkp["blindSum"]([outputBlind], [inputBlind, kernelOffset]);
+	
+	// Create output and kernel
+	const output = createOutput(outputBlind, outputValue);
+	const kernel = createKernel(excessBlind);
+	
+	// Return body's arguments before the kernel offset
+	return [
+	
+		// Inputs
+		secp256k1Zkp["pedersenCommit"](inputBlind, INPUT_VALUE),
+		
+		// Outputs
+		output["Commit"],
+		
+		// Proofs
+		[output["Proof"]],
+		
+		// Kernel excesses
+		kernel["Excess"],
+		
+		// Kernel signatures
+		kernel["Signature"],
+		
+		// Kernel messages
+		kernel["Message"]
+	];
+};
+
+
+// Tests
+
+// Validate block with a kernel offset
+test("validateBlock accepts a block with a non-zero kernel offset", async function() {
+
+	// Create block with a kernel offset
+	const kernelOffset = createBlind();
+	const body = createBody(BLOCK_OUTPUT_VALUE, kernelOffset);
+	
+	// Check that the block is valid
+	assert.strictEqual(await secp256k1Zkp["validateBlock"](...body, kernelOffset, REWARD), true);
+});
+
+// Validate block without its kernel offset
+test("validateBlock rejects a block without its kernel offset", async function() {
+
+	// Create block with a kernel offset
+	const kernelOffset = createBlind();
+	const body = createBody(BLOCK_OUTPUT_VALUE, kernelOffset);
+	
+	// Check that the block isn't valid with a zero kernel offset
+	assert.strictEqual(await secp256k1Zkp["validateBlock"](...body, new Uint8Array(32), REWARD), false);
+});
+
+// Validate block with the wrong reward
+test("validateBlock rejects a block with the wrong reward", async function() {
+
+	// Create block with a kernel offset
+	const kernelOffset = createBlind();
+	const body = createBody(BLOCK_OUTPUT_VALUE, kernelOffset);
+	
+	// Check that the block isn't valid with a different reward
+	assert.strictEqual(await secp256k1Zkp["validateBlock"](...body, kernelOffset, FEE), false);
+});
+
+// Validate transaction with a kernel offset and fee
+test("validateTransaction accepts a transaction with a non-zero kernel offset and fee", async function() {
+
+	// Create transaction with a kernel offset
+	const kernelOffset = createBlind();
+	const body = createBody(TRANSACTION_OUTPUT_VALUE, kernelOffset);
+	
+	// Check that the transaction is valid
+	assert.strictEqual(await secp256k1Zkp["validateTransaction"](...body, kernelOffset, FEE), true);
+	
+	// Check that the transaction isn't valid without its fee
+	assert.strictEqual(await secp256k1Zkp["validateTransaction"](...body, kernelOffset, "0"), false);
+});
+
+// Validate transaction with an inverted excess
+test("validateTransaction rejects a transaction whose excess is the inputs minus the outputs", async function() {
+
+	// Create transaction with a kernel offset and an excess that uses the opposite sign convention than the chain
+	const kernelOffset = createBlind();
+	const body = createBody(TRANSACTION_OUTPUT_VALUE, kernelOffset, true);
+	
+	// Check that the transaction isn't valid with its kernel offset or the negated kernel offset
+	assert.strictEqual(await secp256k1Zkp["validateTransaction"](...body, kernelOffset, FEE), false);
+	assert.strictEqual(await secp256k1Zkp["validateTransaction"](...body, secp256k1Zkp["blindSum"]([], [kernelOffset]), FEE), false);
+});
+
+// Validate transaction with many kernels
+test("validateTransaction verifies many kernel signatures together and rejects one invalid signature", async function() {
+
+	// Create input and output blinds and a kernel offset
+	const kernelOffset = createBlind();
+	const inputBlind = createBlind();
+	const outputBlind = createBlind();
+	
+	// Split the transaction's excess into many kernels whose excesses add up to the output minus the input minus the kernel offset
+	const excessBlinds = [];
+	for(let i = 0; i < NUMBER_OF_KERNELS - 1; ++i) {
+	
+		// Add random excess blind
+		excessBlinds.push(createBlind());
+	}
+	excessBlinds.push(secp256k1Zkp["blindSum"]([outputBlind], [inputBlind, kernelOffset, ...excessBlinds]));
+	
+	// Create output and kernels
+	const kernels = excessBlinds.map(function(excessBlind) {
+	
+		// Return kernel
+		return createKernel(excessBlind);
+	});
+	const output = createOutput(outputBlind, TRANSACTION_OUTPUT_VALUE);
+	const kernelExcesses = new Uint8Array(kernels.length * 33);
+	const kernelSignatures = new Uint8Array(kernels.length * 64);
+	const kernelMessages = new Uint8Array(kernels.length * 32);
+	for(let i = 0; i < kernels.length; ++i) {
+	
+		// Add kernel's excess, signature, and message
+		kernelExcesses.set(kernels[i]["Excess"], i * 33);
+		kernelSignatures.set(kernels[i]["Signature"], i * 64);
+		kernelMessages.set(kernels[i]["Message"], i * 32);
+	}
+	const body = [secp256k1Zkp["pedersenCommit"](inputBlind, INPUT_VALUE), output["Commit"], [output["Proof"]], kernelExcesses, kernelSignatures, kernelMessages];
+	
+	// Check that the transaction is valid
+	assert.strictEqual(await secp256k1Zkp["validateTransaction"](...body, kernelOffset, FEE), true);
+	
+	// Check that the transaction isn't valid when a kernel in the second batch has another kernel's signature
+	const invalidKernelSignatures = kernelSignatures.slice();
+	invalidKernelSignatures.copyWithin((NUMBER_OF_KERNELS - 2) * 64, 0, 64);
+	assert.strictEqual(await secp256k1Zkp["validateTransaction"](...body.slice(0, 4), invalidKernelSignatures, kernelMessages, kernelOffset, FEE), false);
+});
+
+// Validate with an invalid kernel offset
+test("validateBlock fails with an invalid kernel offset", function() {
+
+	// Create block with a kernel offset
+	const kernelOffset = createBlind();
+	const body = createBody(BLOCK_OUTPUT_VALUE, kernelOffset);
+	
+	// Check that validating with a kernel offset that isn't a blind fails
+	assert.strictEqual(secp256k1Zkp["validateBlock"](...body, kernelOffset.subarray(1), REWARD), secp256k1Zkp["OPERATION_FAILED"]);
+});
+
+// Validate block with a progress callback
+test("validateBlock reports progress until every item was processed", async function() {
+
+	// Create block with a kernel offset
+	const kernelOffset = createBlind();
+	const body = createBody(BLOCK_OUTPUT_VALUE, kernelOffset);
+	
+	// Check that the block is valid while recording its progress
+	const progress = [];
+	assert.strictEqual(await secp256k1Zkp["validateBlock"](...body, kernelOffset, REWARD, undefined, function(processed, total) {
+	
+		// Record progress
+		progress.push([processed, total]);
+		
+	}), true);
+	
+	// Check that the last progress was delivered before the result and covers the input, the output and its proof, and the kernel and its signature
+	assert.deepStrictEqual(progress[progress.length - 1], [5, 5]);
+});
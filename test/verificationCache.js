@@ -0,0 +1,94 @@
+// Use strict
+"use strict";
+
+
+// Requires
+
+// Test
+const test = require("node:test");
+
+// Assert
+const assert = require("node:assert");
+
+// Crypto
+const crypto = require("crypto");
+
+// Secp256k1-zkp
+const secp256k1Zkp = require("../index.js");
+
+
+// Constants
+
+// Number of proofs to verify
+const NUMBER_OF_PROOFS = 4;
+
+// Proof cache capacity
+const PROOF_CACHE_CAPACITY = 1024;
+
+// Number of signatures to verify
+const NUMBER_OF_SIGNATURES = 64;
+
+
+// Supporting function implementation
+
+// Create blind
+const createBlind = function() {
+
+	// Return random blind
+	return new Uint8Array(crypto.randomBytes(32));
+};
+
+
+// Tests
+
+// Proof cache memory
+test("proof cache memory grows with new entries and is released when the cache shrinks", function() {
+
+	// Enable the proof cache
+	assert.strictEqual(secp256k1Zkp["setProofCacheCapacity"](PROOF_CACHE_CAPACITY), true);
+	const initialMemory = secp256k1Zkp["getMemoryUsage"]()["ProofCache"];
+	
+	// Go through all proofs
+	for(let i = 0; i < NUMBER_OF_PROOFS; ++i) {
+	
+		// Verify a new proof which adds it to the proof cache
+		const blind = createBlind();
+		const proof = secp256k1Zkp["createBulletproof"](blind, "1", createBlind(), createBlind(), new Uint8Array([]), new Uint8Array(20));
+		assert.strictEqual(secp256k1Zkp["verifyBulletproof"](proof, secp256k1Zkp["pedersenCommit"](blind, "1"), new Uint8Array([])), true);
+	}
+	
+	// Check that the proof cache's memory grew
+	const grownMemory = secp256k1Zkp["getMemoryUsage"]()["ProofCache"];
+	assert.ok(grownMemory > initialMemory);
+	
+	// Check that emptying the proof cache releases its memory
+	assert.strictEqual(secp256k1Zkp["setProofCacheCapacity"](0), true);
+	assert.ok(secp256k1Zkp["getMemoryUsage"]()["ProofCache"] < grownMemory);
+});
+
+// Signature cache memory
+test("signature cache memory grows with new entries and is released when the cache is disabled", function() {
+
+	// Enable the signature cache
+	assert.strictEqual(secp256k1Zkp["setSignatureCacheEnabled"](true), true);
+	const initialMemory = secp256k1Zkp["getMemoryUsage"]()["SignatureCache"];
+	
+	// Go through all signatures
+	for(let i = 0; i < NUMBER_OF_SIGNATURES; ++i) {
+	
+		// Verify a new signature which adds it to the signature cache
+		const secretKey = createBlind();
+		const publicKey = secp256k1Zkp["publicKeyFromSecretKey"](secretKey);
+		const message = new Uint8Array(crypto.randomBytes(32));
+		const signature = secp256k1Zkp["createSingleSignerSignature"](message, secretKey, null, publicKey, null, null);
+		assert.strictEqual(secp256k1Zkp["verifySingleSignerSignature"](signature, message, null, publicKey, publicKey, false), true);
+	}
+	
+	// Check that the signature cache's memory grew
+	const grownMemory = secp256k1Zkp["getMemoryUsage"]()["SignatureCache"];
+	assert.ok(grownMemory > initialMemory);
+	
+	// Check that disabling the signature cache releases its memory
+	assert.strictEqual(secp256k1Zkp["setSignatureCacheEnabled"](false), true);
+	assert.ok(secp256k1Zkp["getMemoryUsage"]()["SignatureCache"] < grownMemory);
+});
@@ -0,0 +1,230 @@
+// Use strict
+"use strict";
+
+
+// Requires
+
+// Worker threads
+const workerThreads = require("worker_threads");
+
+// Crypto
+const crypto = require("crypto");
+
+
+// Constants
+
+// Number of workers
+const NUMBER_OF_WORKERS = 3;
+
+// Number of signatures each worker creates and verifies
+const NUMBER_OF_SIGNATURES = 500;
+
+// Number of shared secret keys each worker derives in its bulk job
+const NUMBER_OF_SHARED_SECRET_KEYS = 2000;
+
+// Number of shared secret keys the terminated worker's job derives so that it's still running when it's terminated
+const TERMINATED_NUMBER_OF_SHARED_SECRET_KEYS = 1000000;
+
+
+// Supporting function implementation
+
+// Random secret key
+const randomSecretKey = function() {
+
+	// Return random secret key
+	return new Uint8Array(crypto.randomBytes(32));
+};
+
+// Run worker
+const runWorker = async function() {
+
+	// Load addon in the worker's environment
+	const secp256k1Zkp = require("../index.js");
+	
+	// Check if the worker is the one that will be terminated
+	if(workerThreads["workerData"]["Terminate"] === true) {
+	
+		// Create bulk job that won't finish before the worker is terminated
+		const secretKey = randomSecretKey();
+		const publicKey = secp256k1Zkp["publicKeyFromSecretKey"](randomSecretKey());
+		const publicKeys = new Uint8Array(publicKey.length * TERMINATED_NUMBER_OF_SHARED_SECRET_KEYS);
+		for(let i = 0; i < TERMINATED_NUMBER_OF_SHARED_SECRET_KEYS; ++i) {
+		
+			// Add public key to the public keys
+			publicKeys.set(publicKey, i * publicKey.length);
+		}
+		const job = secp256k1Zkp["sharedSecretKeysFromSecretKeysAndPublicKeys"](secretKey, publicKeys);
+		
+		// Report that the job started
+		workerThreads["parentPort"].postMessage({"Started": true});
+		
+		// Wait for the job which won't finish
+		await job;
+		
+		// Return
+		return;
+	}
+	
+	// Go through all signatures
+	const start = performance.now();
+	let valid = true;
+	for(let i = 0; i < NUMBER_OF_SIGNATURES; ++i) {
+	
+		// Sign random message with a random secret key
+		const secretKey = randomSecretKey();
+		const publicKey = secp256k1Zkp["publicKeyFromSecretKey"](secretKey);
+		const message = new Uint8Array(crypto.randomBytes(32));
+		const signature = secp256k1Zkp["createSingleSignerSignature"](message, secretKey, null, publicKey, null, null);
+		
+		// Check if signature doesn't verify or a different message verifies
+		if(secp256k1Zkp["verifySingleSignerSignature"](signature, message, null, publicKey, publicKey, false) !== true || secp256k1Zkp["verifySingleSignerSignature"](signature, new Uint8Array(crypto.randomBytes(32)), null, publicKey, publicKey, false) !== false) {
+		
+			// Clear valid
+			valid = false;
+		}
+	}
+	
+	// Create bulk job
+	const secretKey = randomSecretKey();
+	const publicKeys = new Uint8Array(33 * NUMBER_OF_SHARED_SECRET_KEYS);
+	for(let i = 0; i < NUMBER_OF_SHARED_SECRET_KEYS; ++i) {
+	
+		// Add random public key to the public keys
+		publicKeys.set(secp256k1Zkp["publicKeyFromSecretKey"](randomSecretKey()), i * 33);
+	}
+	
+	// Check if the bulk job's results aren't the same as deriving each shared secret key by itself
+	const sharedSecretKeys = await secp256k1Zkp["sharedSecretKeysFromSecretKeysAndPublicKeys"](secretKey, publicKeys);
+	if(sharedSecretKeys === secp256k1Zkp["OPERATION_FAILED"]) {
+	
+		// Clear valid
+		valid = false;
+	}
+	else {
+	
+		// Go through all shared secret keys
+		for(let i = 0; i < NUMBER_OF_SHARED_SECRET_KEYS; ++i) {
+		
+			// Check if shared secret key isn't the same as deriving it by itself
+			if(Buffer.compare(sharedSecretKeys.subarray(i * 32, (i + 1) * 32), secp256k1Zkp["sharedSecretKeyFromSecretKeyAndPublicKey"](secretKey, publicKeys.subarray(i * 33, (i + 1) * 33)))) {
+			
+				// Clear valid
+				valid = false;
+				
+				// Break
+				break;
+			}
+		}
+	}
+	
+	// Report result
+	workerThreads["parentPort"].postMessage({
+	
+		// Valid
+		"Valid": valid,
+		
+		// Operations
+		"Operations": NUMBER_OF_SIGNATURES * 2 + NUMBER_OF_SHARED_SECRET_KEYS,
+		
+		// Elapsed
+		"Elapsed": performance.now() - start
+	});
+};
+
+// Start worker
+const startWorker = function(terminate) {
+
+	// Return worker that runs this file
+	return new workerThreads.Worker(__filename, {
+	
+		// Worker data
+		"workerData": {
+		
+			// Terminate
+			"Terminate": terminate
+		}
+	});
+};
+
+
+// Main function
+
+// Check if running in a worker
+if(workerThreads["isMainThread"] === false) {
+
+	// Run worker
+	runWorker();
+}
+
+// Otherwise
+else {
+
+	// Requires
+	const test = require("node:test");
+	const assert = require("node:assert");
+	
+	// Workers
+	test("verification and signing run independently in multiple workers while one is terminated", async function(context) {
+	
+		// Start worker that will be terminated
+		const terminatedWorker = startWorker(true);
+		const terminatedExitCode = new Promise(function(resolve, reject) {
+		
+			// Resolve with the worker's exit code
+			terminatedWorker.once("exit", resolve);
+			terminatedWorker.once("error", reject);
+		});
+		
+		// Terminate worker once its job started
+		terminatedWorker.once("message", function() {
+		
+			// Terminate worker while its job is running
+			terminatedWorker.terminate();
+		});
+		
+		// Go through all workers
+		const start = performance.now();
+		const results = await Promise.all(Array.from({"length": NUMBER_OF_WORKERS}, function() {
+		
+			// Return promise for the worker's result
+			return new Promise(function(resolve, reject) {
+			
+				// Start worker
+				const worker = startWorker(false);
+				
+				// Resolve with the worker's result
+				worker.once("message", resolve);
+				worker.once("error", reject);
+				worker.once("exit", function(exitCode) {
+				
+					// Check if worker exited without a result
+					if(exitCode !== 0) {
+					
+						// Reject
+						reject(new Error("Worker exited with " + exitCode.toString()));
+					}
+				});
+			});
+		}));
+		const elapsed = performance.now() - start;
+		
+		// Check that the terminated worker was terminated instead of finishing
+		assert.strictEqual(await terminatedExitCode, 1);
+		
+		// Go through all results
+		let operations = 0;
+		for(const result of results) {
+		
+			// Check that the worker's signatures and shared secret keys were valid
+			assert.strictEqual(result["Valid"], true);
+			
+			// Report the worker's throughput
+			context.diagnostic("worker: " + Math.round(result["Operations"] / result["Elapsed"] * 1000).toString() + " operations/s");
+			operations += result["Operations"];
+		}
+		
+		// Report the combined throughput
+		context.diagnostic("combined: " + Math.round(operations / elapsed * 1000).toString() + " operations/s across " + NUMBER_OF_WORKERS.toString() + " workers");
+		assert.ok(operations / elapsed > 0);
+	});
+}